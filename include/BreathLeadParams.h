@@ -0,0 +1,207 @@
+/*
+ * BreathLeadParams.h
+ *
+ * Parameter IDs, APVTS layout and versioned parameter snapshots
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <atomic>
+#include <cstdint>
+
+namespace BreathLeadParamIDs
+{
+    inline constexpr const char* air               = "air";
+    inline constexpr const char* tone              = "tone";
+    inline constexpr const char* formant           = "formant";
+    inline constexpr const char* resistance        = "resistance";
+    inline constexpr const char* vibratoDepth      = "vibratoDepth";
+    inline constexpr const char* vibratoRateHz     = "vibratoRateHz";
+    inline constexpr const char* noiseColor        = "noiseColor";
+    inline constexpr const char* sineAnchor        = "sineAnchor";
+    inline constexpr const char* motionSustain     = "motionSustain";
+    inline constexpr const char* motionSensitivity = "motionSensitivity";
+    inline constexpr const char* attackMs          = "attackMs";
+    inline constexpr const char* releaseMs         = "releaseMs";
+    inline constexpr const char* outputGainDb      = "outputGainDb";
+
+    // plugin-level input handling; not part of the DSP parameter set below
+    inline constexpr const char* breathInput       = "breathInput";
+    inline constexpr const char* breathInputGainDb = "breathInputGainDb";
+    inline constexpr const char* voiceMode         = "voiceMode";   // choice, in BreathLeadSynth::VoiceMode order
+}
+
+// Parameter index, in BreathLeadDSP::setParams argument order
+enum class BreathLeadParam : int
+{
+    air, tone, formant, resistance,
+    vibratoDepth, vibratoRateHz,
+    noiseColor, sineAnchor,
+    motionSustain, motionSensitivity,
+    attackMs, releaseMs,
+    outputGainDb,
+    numParams
+};
+
+namespace BreathLeadParamIDs
+{
+    inline constexpr int numParams = (int) BreathLeadParam::numParams;
+
+    // indexed by BreathLeadParam
+    inline constexpr const char* all[numParams] =
+    {
+        air, tone, formant, resistance,
+        vibratoDepth, vibratoRateHz,
+        noiseColor, sineAnchor,
+        motionSustain, motionSensitivity,
+        attackMs, releaseMs,
+        outputGainDb
+    };
+}
+
+inline juce::AudioProcessorValueTreeState::ParameterLayout makeBreathLeadParameterLayout()
+{
+    using namespace BreathLeadParamIDs;
+    using Float = juce::AudioParameterFloat;
+    using Bool  = juce::AudioParameterBool;
+
+    juce::AudioProcessorValueTreeState::ParameterLayout layout;
+
+    layout.add (std::make_unique<Float> (air,        "Air",        0.0f, 1.0f, 0.45f));
+    layout.add (std::make_unique<Float> (tone,       "Tone",       0.0f, 1.0f, 0.5f));
+    layout.add (std::make_unique<Float> (formant,    "Formant",    0.0f, 1.0f, 0.5f));
+    layout.add (std::make_unique<Float> (resistance, "Resistance", 0.0f, 1.0f, 0.3f));
+
+    layout.add (std::make_unique<Float> (vibratoDepth,  "Vibrato Depth", 0.0f, 1.0f, 0.1f));
+    layout.add (std::make_unique<Float> (vibratoRateHz, "Vibrato Rate",  0.5f, 8.0f, 5.0f));
+
+    layout.add (std::make_unique<Float> (noiseColor, "Noise Color", 0.0f, 1.0f, 0.7f));
+    layout.add (std::make_unique<Float> (sineAnchor, "Sine Anchor", 0.0f, 1.0f, 0.3f));
+
+    layout.add (std::make_unique<Bool>  (motionSustain,     "Motion Sustain", true));
+    layout.add (std::make_unique<Float> (motionSensitivity, "Motion Sensitivity", 0.0f, 1.0f, 0.6f));
+
+    layout.add (std::make_unique<Float> (attackMs,     "Attack",      1.0f, 500.0f, 50.0f));
+    layout.add (std::make_unique<Float> (releaseMs,    "Release",     5.0f, 2000.0f, 300.0f));
+    layout.add (std::make_unique<Float> (outputGainDb, "Output Gain", -24.0f, 6.0f, -3.0f));
+
+    layout.add (std::make_unique<Bool>  (breathInput,       "Breath Input", false));
+    layout.add (std::make_unique<Float> (breathInputGainDb, "Breath Input Gain", -12.0f, 36.0f, 12.0f));
+
+    layout.add (std::make_unique<juce::AudioParameterChoice> (voiceMode, "Voice Mode",
+                                                              juce::StringArray { "Mono", "Unison", "Poly" }, 0));
+
+    return layout;
+}
+
+//==============================================================================
+/*
+ * Versioned parameter snapshot
+ *
+ * Writer side (APVTS listener, any thread): stores the new value, bumps the
+ * parameter's stamp, then the shared generation.
+ * Reader side (audio thread): one Reader per consumer; poll() is a single
+ * generation compare when nothing moved, otherwise a bitmask of the
+ * parameters whose stamp changed since that reader last looked.
+ */
+class BreathLeadParamSnapshot : private juce::AudioProcessorValueTreeState::Listener
+{
+public:
+    static constexpr int numParams = BreathLeadParamIDs::numParams;
+
+    // detached snapshot (values start at zero; drive it with setValue)
+    BreathLeadParamSnapshot() = default;
+
+    explicit BreathLeadParamSnapshot (juce::AudioProcessorValueTreeState& apvtsRef)
+    : apvts(&apvtsRef)
+    {
+        for (int i = 0; i < numParams; ++i)
+        {
+            values[i].store(apvts->getRawParameterValue(BreathLeadParamIDs::all[i])->load());
+            apvts->addParameterListener(BreathLeadParamIDs::all[i], this);
+        }
+    }
+
+    ~BreathLeadParamSnapshot() override
+    {
+        if (apvts != nullptr)
+            for (auto* id : BreathLeadParamIDs::all)
+                apvts->removeParameterListener(id, this);
+    }
+
+    void setValue (BreathLeadParam param, float newValue) noexcept
+    {
+        const int i = (int) param;
+        values[i].store(newValue, std::memory_order_relaxed);
+        stamps[i].fetch_add(1, std::memory_order_release);
+        generation.fetch_add(1, std::memory_order_release);
+    }
+
+    float getValue (BreathLeadParam param) const noexcept
+    {
+        return values[(int) param].load(std::memory_order_relaxed);
+    }
+
+    std::uint32_t getGeneration() const noexcept { return generation.load(std::memory_order_acquire); }
+
+    class Reader
+    {
+    public:
+        // bit i set = parameter i changed since the previous poll; first poll reports all
+        std::uint32_t poll (const BreathLeadParamSnapshot& snapshot) noexcept
+        {
+            const auto gen = snapshot.getGeneration();
+            if (gen == lastGeneration && ! stale)
+                return 0;
+
+            std::uint32_t dirty = 0;
+            for (int i = 0; i < numParams; ++i)
+            {
+                const auto stamp = snapshot.stamps[i].load(std::memory_order_acquire);
+                if (stale || stamp != seen[i])
+                    dirty |= 1u << i;
+                seen[i] = stamp;
+            }
+
+            lastGeneration = gen;
+            stale = false;
+            return dirty;
+        }
+
+        // next poll reports every parameter (e.g. after the consumer is re-prepared)
+        void invalidate() noexcept { stale = true; }
+
+    private:
+        std::uint32_t lastGeneration = 0;
+        std::uint32_t seen[numParams] {};
+        bool stale = true;
+    };
+
+    // Forwards every parameter the reader has not seen yet to target.setParam
+    template <typename Target>
+    void pushChanges (Reader& reader, Target& target) const
+    {
+        auto dirty = reader.poll(*this);
+
+        for (int i = 0; dirty != 0; ++i, dirty >>= 1)
+            if ((dirty & 1u) != 0)
+                target.setParam((BreathLeadParam) i, getValue((BreathLeadParam) i));
+    }
+
+private:
+    void parameterChanged (const juce::String& parameterID, float newValue) override
+    {
+        for (int i = 0; i < numParams; ++i)
+            if (parameterID == BreathLeadParamIDs::all[i])
+                return setValue((BreathLeadParam) i, newValue);
+    }
+
+    juce::AudioProcessorValueTreeState* apvts = nullptr;
+
+    std::atomic<float> values[numParams] {};
+    std::atomic<std::uint32_t> stamps[numParams] {};
+    std::atomic<std::uint32_t> generation { 0 };
+};
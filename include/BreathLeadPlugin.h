@@ -0,0 +1,95 @@
+/*
+ * BreathLeadPlugin.h
+ *
+ * JUCE AudioProcessor wrapper for the BreathLead synth
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "BreathLeadParams.h"
+#include "synth/BreathLeadSynth.h"
+#include "dsp/BreathFollower.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+class BreathLeadPlugin : public juce::AudioProcessor,
+                         private juce::AudioProcessorValueTreeState::Listener,
+                         private juce::AsyncUpdater
+{
+public:
+    BreathLeadPlugin();
+    ~BreathLeadPlugin() override;
+
+    //==============================================================================
+    // AudioProcessor Interface
+    void prepareToPlay (double sampleRate, int samplesPerBlock) override;
+    void releaseResources() override;
+
+    void processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) override;
+    void processBlockBypassed (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) override;
+
+    // Stereo or mono out; the optional breath input bus may be off, mono or stereo
+    bool isBusesLayoutSupported (const BusesLayout& layouts) const override;
+
+    juce::AudioProcessorEditor* createEditor() override;
+    bool hasEditor() const override { return true; }
+
+    const juce::String getName() const override { return "BreathLead"; }
+
+    bool acceptsMidi() const override { return true; }
+    bool producesMidi() const override { return false; }
+    double getTailLengthSeconds() const override { return 2.0; }
+
+    int getNumPrograms() override { return 1; }
+    int getCurrentProgram() override { return 0; }
+    void setCurrentProgram (int) override {}
+    const juce::String getProgramName (int) override { return "Default"; }
+    void changeProgramName (int, const juce::String&) override {}
+
+    //==============================================================================
+    // Plugin State Management
+    void getStateInformation (juce::MemoryBlock& destData) override;
+    void setStateInformation (const void* data, int sizeInBytes) override;
+
+    // Applies a preset file's <PRESET><VALUES><PARAM id value/> list (plain,
+    // unnormalised values). Returns false if it is not a BreathLead preset;
+    // unknown ids are skipped.
+    bool applyPreset (const juce::XmlElement& preset);
+
+    juce::AudioProcessorValueTreeState& getValueTreeState() { return *parameters_; }
+
+    //==============================================================================
+    // Channel Names
+    const juce::String getInputChannelName (int channelIndex) const override;
+    const juce::String getOutputChannelName (int channelIndex) const override;
+    bool isInputChannelStereoPair (int index) const override;
+    bool isOutputChannelStereoPair (int index) const override;
+
+private:
+    // Voice mode picks the synth's voice set at construction, so a change
+    // rebuilds the synth on the message thread (see handleAsyncUpdate)
+    void parameterChanged (const juce::String& parameterID, float newValue) override;
+    void handleAsyncUpdate() override;
+
+    BreathLeadSynth::VoiceMode requestedVoiceMode() const;
+    std::unique_ptr<BreathLeadSynth> makePreparedSynth() const;
+
+    std::unique_ptr<juce::AudioProcessorValueTreeState> parameters_;
+    std::unique_ptr<BreathLeadSynth> synth_;
+
+    // Breath mode: input bus -> envelope follower -> per-sample air pressure
+    BreathFollower breathFollower_;
+    std::vector<float> breathPressure_;
+    std::atomic<float>* breathInputParam_ = nullptr;
+    std::atomic<float>* breathGainParam_ = nullptr;
+    std::atomic<float>* voiceModeParam_ = nullptr;
+
+    double preparedSampleRate_ = 0.0;   // 0 until prepareToPlay
+    int preparedBlockSize_ = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BreathLeadPlugin)
+};
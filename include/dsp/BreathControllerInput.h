@@ -0,0 +1,189 @@
+/*
+ * BreathControllerInput.h
+ *
+ * High-resolution expressive controller decoding
+ * - 14-bit MIDI 1.0 pairs: CC1/33 mod wheel, CC2/34 breath, CC11/43 expression
+ *   (7-bit senders still reach full scale at 127)
+ * - MIDI 2.0-style 32-bit controller values
+ * - Every update carries a linear ramp length taken from the time since that
+ *   controller's previous update, so a stepped stream plays back as a
+ *   continuous line instead of a staircase
+ *
+ * Created: October 16, 2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+enum class BreathController : int
+{
+    modWheel,   // CC1 (+33)
+    breath,     // CC2 (+34)
+    expression, // CC11 (+43)
+    numControllers
+};
+
+// Controller value over a linear ramp, for engines that smooth per sample
+struct ControllerRamp
+{
+    void setCurrentAndTarget (float value)
+    {
+        current = target = value;
+        step = 0.0f;
+        countdown = 0;
+    }
+
+    void setTarget (float value, int rampSamples)
+    {
+        if (rampSamples <= 0)
+        {
+            setCurrentAndTarget(value);
+            return;
+        }
+
+        target = value;
+        countdown = rampSamples;
+        step = (target - current) / (float) rampSamples;
+    }
+
+    float getNextValue()
+    {
+        if (countdown <= 0)
+            return target;
+
+        current = (--countdown > 0) ? current + step : target;
+        return current;
+    }
+
+    float getCurrentValue() const { return current; }
+    float getTargetValue() const  { return target; }
+    bool isSmoothing() const      { return countdown > 0; }
+
+    float current = 0.0f, target = 0.0f, step = 0.0f;
+    int countdown = 0;
+};
+
+class BreathControllerInput
+{
+public:
+    static constexpr int numControllers = (int) BreathController::numControllers;
+
+    struct Update
+    {
+        BreathController controller;
+        float value;     // 0..1
+        int rampSamples; // reach value linearly over this many samples (0 = step)
+    };
+
+    // Ramps are bounded so a fast stream stays responsive and a sparse one
+    // does not drag behind the player
+    void prepare (double sampleRate, double minRampMs = 1.0, double maxRampMs = 20.0)
+    {
+        minRamp = std::max(1, (int) (minRampMs * 0.001 * sampleRate));
+        maxRamp = std::max(minRamp, (int) (maxRampMs * 0.001 * sampleRate));
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& s : state)
+            s = {};
+    }
+
+    // MIDI 1.0 control change stamped with an absolute sample time. Returns
+    // false (and leaves update alone) for controllers not handled here.
+    // An MSB clears the LSB as the spec asks; the LSB that follows at the same
+    // time refines the value over the same ramp.
+    bool handleControlChange (int controllerNumber, int value, std::int64_t time, Update& update)
+    {
+        int index = 0;
+        bool isLsb = false;
+
+        if (! lookup(controllerNumber, index, isLsb))
+            return false;
+
+        auto& s = state[index];
+        const int v = std::clamp(value, 0, 127);
+
+        if (isLsb)
+        {
+            s.lsb = v;
+            s.hasLsb = true;
+        }
+        else
+        {
+            s.msb = v;
+            s.lsb = 0;
+        }
+
+        const float norm = s.hasLsb ? (float) ((s.msb << 7) | s.lsb) / 16383.0f
+                                    : (float) s.msb / 127.0f;
+
+        update = makeUpdate(index, norm, time);
+        return true;
+    }
+
+    // MIDI 2.0-style 32-bit controller value (0 .. 0xFFFFFFFF)
+    Update handleHighRes (BreathController controller, std::uint32_t value, std::int64_t time)
+    {
+        return makeUpdate((int) controller, (float) ((double) value / 4294967295.0), time);
+    }
+
+    // Maps a MIDI 1.0 MSB controller number (1, 2, 11) to its controller
+    static bool fromControllerNumber (int controllerNumber, BreathController& controller)
+    {
+        int index = 0;
+        bool isLsb = false;
+        if (! lookup(controllerNumber, index, isLsb) || isLsb)
+            return false;
+
+        controller = (BreathController) index;
+        return true;
+    }
+
+    float getValue (BreathController controller) const { return state[(int) controller].value; }
+
+private:
+    static bool lookup (int controllerNumber, int& index, bool& isLsb)
+    {
+        isLsb = controllerNumber >= 32 && controllerNumber < 64;
+        switch (isLsb ? controllerNumber - 32 : controllerNumber)
+        {
+            case 1:  index = (int) BreathController::modWheel;   return true;
+            case 2:  index = (int) BreathController::breath;     return true;
+            case 11: index = (int) BreathController::expression; return true;
+            default: return false;
+        }
+    }
+
+    Update makeUpdate (int index, float value, std::int64_t time)
+    {
+        auto& s = state[index];
+
+        // the update interval is the sender's rate; the second half of a
+        // 14-bit pair arrives at the same time and keeps the first half's ramp
+        if (time != s.lastTime)
+        {
+            s.ramp = (s.lastTime < 0) ? minRamp
+                                      : (int) std::clamp(time - s.lastTime, (std::int64_t) minRamp, (std::int64_t) maxRamp);
+            s.lastTime = time;
+        }
+
+        s.value = value;
+        return { (BreathController) index, value, s.ramp };
+    }
+
+    struct State
+    {
+        int msb = 0, lsb = 0;
+        bool hasLsb = false;  // sender is 14-bit
+        float value = 0.0f;
+        std::int64_t lastTime = -1;
+        int ramp = 0;
+    };
+
+    State state[numControllers];
+    int minRamp = 48, maxRamp = 960;
+};
@@ -0,0 +1,49 @@
+/*
+ * BreathFollower.h
+ *
+ * Envelope follower that turns a breath signal (microphone or analogue
+ * breath sensor on the plugin input) into a 0..1 pressure curve
+ * - Peak detector with separate attack/release, no lookahead: a breath
+ *   onset reaches 95% within ~1 ms and adds no plugin latency
+ * - Input gain sets sensitivity; a small floor keeps room noise at zero
+ *
+ * Created: October 16, 2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+struct BreathFollower
+{
+    void prepare (double sampleRate, double attackMs = 0.3, double releaseMs = 40.0)
+    {
+        attack = (float) std::exp(-1.0 / (attackMs * 0.001 * sampleRate));
+        release = (float) std::exp(-1.0 / (releaseMs * 0.001 * sampleRate));
+        reset();
+    }
+
+    void reset() { level = 0.0f; }
+
+    void setInputGainDb (float db) { gain = std::pow(10.0f, db / 20.0f); }
+
+    // out[i] = pressure 0..1 for input sample in[i] (out may alias in)
+    void process (const float* in, float* out, int numSamples)
+    {
+        constexpr float floor = 0.002f; // about -54 dB after gain
+        constexpr float scale = 1.0f / (1.0f - floor);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float x = std::abs(in[i]) * gain;
+            const float coeff = (x > level) ? attack : release;
+            level = x + coeff * (level - x);
+            out[i] = std::clamp((level - floor) * scale, 0.0f, 1.0f);
+        }
+    }
+
+    float attack = 0.0f, release = 0.0f;
+    float gain = 1.0f;
+    float level = 0.0f;
+};
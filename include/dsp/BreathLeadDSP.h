@@ -0,0 +1,445 @@
+/*
+ * BreathLeadDSP.h
+ *
+ * Physical modeling breath synthesizer
+ * - Noise + sine-anchor excitation
+ * - Pitch bandpass + two formant bandpasses (fused resonator bank)
+ * - Tone tilt (HP/LP), soft saturation
+ * - Motion-sustain energy from expressive controls
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include "dsp/ParamSmootherBank.h"
+#include "dsp/BreathControllerInput.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+enum class BreathLeadParam : int; // BreathLeadParams.h
+
+//==============================================================================
+// Excitation noise (white + pink), generated a block at a time
+//==============================================================================
+
+// Eight xorshift32 generators stepped side by side (vectorises to SSE/AVX/NEON).
+// Output is the lanes in order, buffered so the stream does not depend on how
+// callers slice it into blocks.
+struct LaneXorshift
+{
+    static constexpr int numLanes = 8;
+    static_assert ((numLanes & (numLanes - 1)) == 0, "lane indices are masked");
+
+    void seed (std::uint32_t s)
+    {
+        for (int l = 0; l < numLanes; ++l)
+        {
+            const std::uint32_t v = s + 0x9E3779B9u * (std::uint32_t) l;
+            state[l] = (v != 0u) ? v : 0x12345678u;
+        }
+        poolPos = numLanes;
+    }
+
+    void fill (float* out, int numSamples)
+    {
+        int i = 0;
+        while (i < numSamples && poolPos < numLanes)
+            out[i++] = pool[poolPos++];
+
+        for (; i + numLanes <= numSamples; i += numLanes)
+            generate(out + i);
+
+        // fewer than numLanes left: the mask keeps the lane index in range
+        // for the optimiser as well
+        if (i < numSamples)
+        {
+            generate(pool);
+            const int tail = numSamples - i;
+            for (int l = 0; l < tail; ++l)
+                out[i + l] = pool[l & (numLanes - 1)];
+            poolPos = tail;
+        }
+    }
+
+    // mapped to -1..1
+    void generate (float* dst)
+    {
+        for (int l = 0; l < numLanes; ++l)
+        {
+            std::uint32_t x = state[l];
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            state[l] = x;
+            dst[l] = (float) (std::int32_t) (x >> 8) * (2.0f / 16777216.0f) - 1.0f;
+        }
+    }
+
+    alignas(32) std::uint32_t state[numLanes] {};
+    alignas(32) float pool[numLanes] {};
+    int poolPos = numLanes;
+};
+
+struct BreathNoise
+{
+    void reset (std::uint32_t seed)
+    {
+        white.seed(seed != 0u ? seed : 0x12345678u);
+        pinkSource.seed(~seed);
+        b0 = b1 = b2 = 0.0f;
+    }
+
+    void fillWhite (float* out, int numSamples)
+    {
+        white.fill(out, numSamples);
+    }
+
+    // Paul Kellet "economy" pink filter over its own white stream, so skipping
+    // one colour never shifts the other
+    void fillPink (float* out, int numSamples)
+    {
+        pinkSource.fill(out, numSamples);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float w = out[i];
+            b0 = 0.99765f * b0 + w * 0.0990460f;
+            b1 = 0.96300f * b1 + w * 0.2965164f;
+            b2 = 0.57000f * b2 + w * 1.0526913f;
+            out[i] = (b0 + b1 + b2 + w * 0.1848f) * 0.25f;
+        }
+    }
+
+    LaneXorshift white, pinkSource;
+    float b0 = 0.0f, b1 = 0.0f, b2 = 0.0f;
+};
+
+//==============================================================================
+// Motion energy: how much an expressive control is moving
+//==============================================================================
+
+struct MotionEnergy
+{
+    void prepare (double sampleRate)
+    {
+        // ~400 ms fall so a gesture keeps the note breathing for a moment
+        decay = std::exp (-1.0f / (0.4f * (float) sampleRate));
+    }
+
+    void reset()
+    {
+        last = 0.0f;
+        energy = 0.0f;
+    }
+
+    float process (float x, float sensitivity)
+    {
+        const float d = std::abs (x - last);
+        last = x;
+
+        const float gain = 50.0f + 450.0f * sensitivity;
+        energy = std::max (std::min (1.0f, d * gain), energy * decay);
+        return energy;
+    }
+
+    // input unchanged for a stretch: apply the whole decay at once
+    void advance (float decayFactor) { energy *= decayFactor; }
+
+    float decay = 0.0f;
+    float last = 0.0f;
+    float energy = 0.0f;
+};
+
+//==============================================================================
+// Soft saturation
+//==============================================================================
+
+struct SoftLimiter
+{
+    // Rational tanh approximation, exact at +-3 and flat beyond
+    static float process (float x)
+    {
+        return shape (std::clamp (x, -3.0f, 3.0f));
+    }
+
+    // x already in [-3, 3]
+    static float shape (float x)
+    {
+        const float x2 = x * x;
+        return x * (27.0f + x2) / (27.0f + 9.0f * x2);
+    }
+};
+
+//==============================================================================
+// Tone-tilt biquad
+//==============================================================================
+
+// Transposed direct form II biquad with per-sample linear coefficient ramps.
+// Designed to match juce::dsp::IIR::Coefficients::makeHighPass/makeLowPass
+// (Q = 1/sqrt2) without the ref-counted coefficient objects.
+struct RampedBiquad
+{
+    struct Coeffs { float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f; };
+
+    static Coeffs makeHighPass (double sampleRate, float hz);
+    static Coeffs makeLowPass (double sampleRate, float hz);
+
+    void reset() { s1 = s2 = 0.0f; }
+
+    // Snap to coefficients (no ramp)
+    void setCoeffs (const Coeffs& c) { cur = c; inc = Coeffs { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f }; }
+
+    // Ramp from current to target over numSteps samples
+    void rampTo (const Coeffs& target, int numSteps)
+    {
+        const float k = 1.0f / (float) numSteps;
+        inc.b0 = (target.b0 - cur.b0) * k;
+        inc.b1 = (target.b1 - cur.b1) * k;
+        inc.b2 = (target.b2 - cur.b2) * k;
+        inc.a1 = (target.a1 - cur.a1) * k;
+        inc.a2 = (target.a2 - cur.a2) * k;
+    }
+
+    float processSample (float x)
+    {
+        cur.b0 += inc.b0; cur.b1 += inc.b1; cur.b2 += inc.b2;
+        cur.a1 += inc.a1; cur.a2 += inc.a2;
+
+        const float y = cur.b0 * x + s1;
+        s1 = cur.b1 * x - cur.a1 * y + s2;
+        s2 = cur.b2 * x - cur.a2 * y;
+        return y;
+    }
+
+    Coeffs cur, inc;
+    float s1 = 0.0f, s2 = 0.0f;
+};
+
+//==============================================================================
+// Resonator bank: pitch band + formants
+//==============================================================================
+
+// Four TPT state-variable bandpasses fed the same input. State and
+// coefficients are band-major, one float per band, so each step of the
+// recurrence is a single 4-wide operation (SSE/NEON). Unused bands have
+// weight 0.
+//
+// Same filter as juce::dsp::StateVariableTPTFilter (bandpass), but with the
+// TPT update folded into state-space form: the next state and the weighted
+// output are each one multiply-add per term of x, s1, s2. That takes the
+// per-sample dependency chain from six operations down to two.
+struct ResonatorBank
+{
+    static constexpr int numBands = 4;
+    enum Band { pitch, formant1, formant2, formant3 };
+
+    void reset()
+    {
+        for (int b = 0; b < numBands; ++b)
+            s1[b] = s2[b] = 0.0f;
+    }
+
+    void setBand (int band, double sampleRate, float cutoffHz, float resonance)
+    {
+        tanHalf[band] = std::tan(juce::MathConstants<double>::pi * cutoffHz / sampleRate);
+        r2[band] = 1.0 / resonance;
+        updateCoeffs(band);
+    }
+
+    void setWeight (int band, float w)
+    {
+        weight[band] = w;
+        updateCoeffs(band);
+    }
+
+    // Weighted sum of the band outputs
+    float processSample (float x)
+    {
+        alignas(16) float y[numBands];
+
+        for (int b = 0; b < numBands; ++b)
+        {
+            y[b] = yX[b] * x + yS1[b] * s1[b] + yS2[b] * s2[b];
+            const float n1 = s1X[b] * x + s1S1[b] * s1[b] + s1S2[b] * s2[b];
+            const float n2 = s2X[b] * x + s2S1[b] * s1[b] + s2S2[b] * s2[b];
+            s1[b] = n1;
+            s2[b] = n2;
+        }
+
+        return (y[0] + y[1]) + (y[2] + y[3]);
+    }
+
+    alignas(16) float yX[numBands] {}, yS1[numBands] {}, yS2[numBands] {};
+    alignas(16) float s1X[numBands] {}, s1S1[numBands] {}, s1S2[numBands] {};
+    alignas(16) float s2X[numBands] {}, s2S1[numBands] {}, s2S2[numBands] {};
+    alignas(16) float s1[numBands] {}, s2[numBands] {};
+
+private:
+    void updateCoeffs (int b)
+    {
+        // TPT bandpass: hp = h (x - (g + R2) s1 - s2), bp = g hp + s1,
+        // s1' = g hp + bp, s2' = g bp + (g bp + s2)
+        const double g = tanHalf[b];
+        const double h = 1.0 / (1.0 + r2[b] * g + g * g);
+        const double a = h * (g + r2[b]);
+        const double w = weight[b];
+
+        // bp = g h x + (1 - g a) s1 - g h s2
+        yX[b]  = (float) (w * g * h);
+        yS1[b] = (float) (w * (1.0 - g * a));
+        yS2[b] = (float) (-w * g * h);
+
+        s1X[b]  = (float) (2.0 * g * h);
+        s1S1[b] = (float) (1.0 - 2.0 * g * a);
+        s1S2[b] = (float) (-2.0 * g * h);
+
+        s2X[b]  = (float) (2.0 * g * g * h);
+        s2S1[b] = (float) (2.0 * g * (1.0 - g * a));
+        s2S2[b] = (float) (1.0 - 2.0 * g * g * h);
+    }
+
+    double tanHalf[numBands] {}, r2[numBands] { 1.0, 1.0, 1.0, 1.0 };
+    float weight[numBands] {};
+};
+
+//==============================================================================
+// BreathLeadDSP
+//==============================================================================
+
+class BreathLeadDSP
+{
+public:
+    void prepare (double sampleRate, int samplesPerBlock, int numChannels);
+    void reset();
+
+    void setPitchHz (float hz);
+    void setGate (bool isOn);
+    void setVelocity (float vel01);
+    void setModWheel (float mw01);
+    void setAftertouch (float at01);
+
+    // Expressive controller (see BreathControllerInput), reached linearly over
+    // rampSamples. Wheel and breath both sustain air pressure, expression
+    // scales the output.
+    void setController (BreathController controller, float value01, int rampSamples = 0);
+    void setPitchBendNorm (float pbNorm);
+
+    void setParams (float air, float tone, float formant, float resistance,
+                    float vibrDepth, float vibrRateHz,
+                    float noiseColor, float sineAnchor,
+                    bool motionSustain, float motionSensitivity,
+                    float attackMs, float releaseMs,
+                    float outputGainDb);
+
+    // Single-parameter update; only the state derived from that parameter is recomputed
+    void setParam (BreathLeadParam param, float value);
+
+    // Filter coefficients are recomputed every N samples and interpolated in
+    // between. 1 = per-sample (reference behaviour), 16/32 for normal use.
+    void setControlInterval (int numSamples);
+    int getControlInterval() const { return controlInterval; }
+
+    // Adds numSamples of output to every channel of out, at the current pitch
+    void render (juce::AudioBuffer<float>& out, int startSample, int numSamples);
+
+    // Same, but with a per-sample base pitch (e.g. a glide curve). pitchHzBlock
+    // holds numSamples values; nullptr renders at the current pitch.
+    // pressureBlock, if given, is per-sample breath pressure 0..1 (see
+    // BreathFollower) that drives the air envelope in place of velocity and
+    // mod wheel while the gate is on.
+    void renderBlock (juce::AudioBuffer<float>& out, int startSample, int numSamples,
+                      const float* pitchHzBlock, const float* pressureBlock = nullptr);
+
+    // Idle detection: after gate-off a peak detector watches the output. Once
+    // it has stayed below silenceThreshold for silenceHoldMs, or the estimated
+    // tail has run out, the DSP sleeps and render returns at once until the
+    // next gate-on.
+    bool isActive() const { return ! asleep; }
+
+    // Upper bound on the release tail at the current settings: envelope decay
+    // to silenceThreshold plus resonator ring-out
+    int getTailLengthSamples() const;
+
+    static constexpr float silenceThreshold = 1.0e-5f; // -100 dBFS
+    static constexpr double silenceHoldMs = 50.0;
+    static constexpr double resonatorRingMs = 250.0;   // lowest pitch BP to -100 dB
+
+    static constexpr int maxControlInterval = 64;
+    static constexpr int maxChunkSize = 256; // internal scratch length
+
+private:
+    float coeffFromMs (float ms) const;
+    float midiToHzClamp (float hz) const;
+
+    void updateControlRate (float hz, float tone, float form, float resistanceMix);
+    void renderChunk (juce::AudioBuffer<float>& out, int startSample, int numSamples,
+                      const float* pitchHzBlock, const float* pressureBlock);
+    template <bool Ramping> void renderVoice (int numSamples, const float* pressureBlock);
+    void renderMotion (int numSamples);
+    void renderNoise (int numSamples);
+    void updateIdleState (int numSamples, float peak);
+    void wake();
+    void sleep();
+
+    double sr = 48000.0;
+
+    // note / performance state
+    bool gate = false;
+    float pitchHz = 220.0f;
+    float velocity = 0.0f;
+    float aftertouch = 0.0f;
+    float pitchBend = 0.0f;
+
+    float phase = 0.0f;    // vibrato phase 0..1
+    float oscPhase = 0.0f; // sine-anchor phase 0..1
+    float env = 0.0f;   // air pressure envelope
+
+    bool motionSustainEnabled = true;
+    float envA = 0.0f, envR = 0.0f;
+
+    // control-rate coefficient state
+    int controlInterval = 16;
+    int controlCountdown = 0;
+    bool coeffsValid = false;
+
+    // idle detection
+    bool asleep = true;
+    int quietSamples = 0;    // consecutive output samples below silenceThreshold
+    int releasedSamples = 0; // samples since gate-off
+
+    // smoothed params, advanced once per chunk
+    enum Smoothed
+    {
+        smAir, smTone, smFormant, smResist,
+        smVibrDepth, smVibrRate,
+        smNoiseColor, smSineAnchor,
+        smMotionSens,
+        smOutGain,
+        smModWheel, smBreath, smExpression, // controllers, ramped per update
+        numSmoothed
+    };
+
+    // the ones read by the per-sample voice loop
+    static constexpr std::uint32_t voiceParamMask = (1u << smAir) | (1u << smTone) | (1u << smFormant)
+                                                  | (1u << smResist) | (1u << smSineAnchor) | (1u << smOutGain)
+                                                  | (1u << smModWheel) | (1u << smBreath) | (1u << smExpression);
+
+    ParamSmootherBank<numSmoothed, maxChunkSize> smoothers;
+
+    // voice
+    BreathNoise noise;
+    MotionEnergy meMW, meAT, mePB, mePitch;
+
+    ResonatorBank resonators;
+    RampedBiquad hp, lp;
+
+    // per-chunk scratch (no allocation on the audio thread)
+    float hzScratch[maxChunkSize] {};
+    float motionScratch[maxChunkSize] {};
+    alignas(32) float noiseScratch[maxChunkSize] {};
+    alignas(32) float pinkScratch[maxChunkSize] {};
+    float monoScratch[maxChunkSize] {};
+};
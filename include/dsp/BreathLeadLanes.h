@@ -0,0 +1,120 @@
+/*
+ * BreathLeadLanes.h
+ *
+ * Lane-packed BreathLead engine for unison stacks and polyphonic pads
+ * - 8 voices stored struct-of-arrays
+ * - Noise, resonators, envelope and saturation run for all lanes per sample
+ * - Lane loops are fixed-width over aligned arrays so the compiler emits
+ *   SSE/AVX (x86) or NEON (arm64) without per-platform intrinsics
+ *
+ * Created: October 16, 2026
+ */
+
+#pragma once
+
+#include "dsp/BreathLeadDSP.h"
+#include <cstdint>
+
+class BreathLeadLanes
+{
+public:
+    static constexpr int numLanes = 8;
+
+    BreathLeadLanes();
+
+    void prepare (double sampleRate, int samplesPerBlock);
+    void reset();
+
+    // Per-lane note control
+    void noteOn (int lane, float hz, float vel01);
+    void noteOff (int lane);
+    void setLanePitchHz (int lane, float hz);
+    void setLanePan (int lane, float pan, float level = 1.0f); // -1 left .. +1 right; level scales the lane
+    bool isLaneActive (int lane) const;
+    bool isAnyLaneActive() const;
+
+    // Channel-wide expression (shared by all lanes)
+    void setModWheel (float mw01);
+    void setAftertouch (float at01);
+    void setPitchBendNorm (float pbNorm);
+    void setController (BreathController controller, float value01, int rampSamples = 0); // as BreathLeadDSP
+
+    // Same parameter set as BreathLeadDSP::setParams
+    void setParams (float air, float tone, float formant, float resistance,
+                    float vibrDepth, float vibrRateHz,
+                    float noiseColor, float sineAnchor,
+                    bool motionSustain, float motionSensitivity,
+                    float attackMs, float releaseMs,
+                    float outputGainDb);
+
+    // Single-parameter update; only the state derived from that parameter is recomputed
+    void setParam (BreathLeadParam param, float value);
+
+    void setControlInterval (int numSamples);
+
+    // Adds the lane mix to out (channel 0 = left, 1 = right; mono if one channel).
+    // With every gate off and the mix below BreathLeadDSP::silenceThreshold for
+    // silenceHoldMs the engine sleeps; render is free until the next noteOn.
+    // pressureBlock: optional per-sample breath pressure, as BreathLeadDSP::renderBlock
+    void render (juce::AudioBuffer<float>& out, int startSample, int numSamples,
+                 const float* pressureBlock = nullptr);
+
+    bool isSleeping() const { return asleep; }
+
+private:
+    void updateControlRate (const float* hz, float tone, float form, float resistanceMix);
+    bool anyGateOn() const;
+    void updateIdleState (int numSamples, float peak);
+    void wake();
+    void sleep();
+
+    double sr = 48000.0;
+    float invSr = 1.0f / 48000.0f;
+
+    // channel-wide state
+    float aftertouch = 0.0f, pitchBend = 0.0f;
+    ControllerRamp controllers[BreathControllerInput::numControllers];
+    float vibPhase = 0.0f;
+    bool motionSustainEnabled = true;
+    float envA = 0.0f, envR = 0.0f;
+    MotionEnergy meMW, meAT, mePB;
+    float motionDecay = 0.0f;
+
+    int controlInterval = 16;
+    int controlCountdown = 0;
+    bool coeffsValid = false;
+
+    // idle detection
+    bool asleep = true;
+    int quietSamples = 0;
+
+    juce::SmoothedValue<float> airS, toneS, formantS, resistS;
+    juce::SmoothedValue<float> vibrDepthS, vibrRateS;
+    juce::SmoothedValue<float> noiseColorS, sineAnchorS;
+    juce::SmoothedValue<float> motionSensS;
+    juce::SmoothedValue<float> outGainS;
+
+    // tone tilt coefficients are shared, state is per lane
+    RampedBiquad::Coeffs hpC, hpInc, lpC, lpInc;
+
+    // per-lane state (struct-of-arrays)
+    alignas(32) float gate[numLanes] {};
+    alignas(32) float velocity[numLanes] {};
+    alignas(32) float baseHz[numLanes] {};
+    alignas(32) float env[numLanes] {};
+    alignas(32) float oscPhase[numLanes] {};
+    alignas(32) float gainL[numLanes] {};
+    alignas(32) float gainR[numLanes] {};
+
+    alignas(32) std::uint32_t rng[numLanes] {};
+    alignas(32) float pink0[numLanes] {}, pink1[numLanes] {}, pink2[numLanes] {};
+
+    alignas(32) float mePitchLast[numLanes] {}, mePitchEnergy[numLanes] {};
+
+    // resonator bank: pitch, formant 1, formant 2 (TPT SVF bandpass)
+    alignas(32) float svfG[3][numLanes] {}, svfR2[3][numLanes] {}, svfH[3][numLanes] {};
+    alignas(32) float svfS1[3][numLanes] {}, svfS2[3][numLanes] {};
+
+    alignas(32) float hpS1[numLanes] {}, hpS2[numLanes] {};
+    alignas(32) float lpS1[numLanes] {}, lpS2[numLanes] {};
+};
@@ -0,0 +1,220 @@
+/*
+ * FastMath.h
+ *
+ * Polynomial transcendental kernels shared by the DSP engines
+ * - sin/cos (turns and radians), exp2/log2, exp, semitone ratios
+ * - Scalar kernels are branch-free; the *Block forms are plain loops over
+ *   them so the compiler vectorises them (SSE/AVX on x86, NEON on arm64)
+ * - Coefficients are minimax fits; error budget below is measured against
+ *   libm in double precision (tests/dsp/FastMathTests.cpp)
+ *
+ *   function           domain                      max error
+ *   sin2Pi / cos2Pi    |turns| <= 2^16             2.5e-7 abs
+ *   sin / cos          |radians| <= 2^12           4.0e-7 abs
+ *   exp2               [-126, 127]                 2.5e-7 rel
+ *   exp                [-87, 88]                   2.5e-7 rel
+ *   log2               normal floats > 0           4.0e-7 abs, or 4.0e-7 rel
+ *                                                  when |log2 x| > 1
+ *   semitonesToRatio   [-1512, 1524] semitones     2.5e-7 rel
+ *
+ *   Out-of-domain inputs are clamped (exp2/exp/semitonesToRatio) or
+ *   undefined (log2 of x <= 0 or denormal x).
+ *
+ * Created: October 16, 2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace SchillingerEcosystem::DSP::FastMath
+{
+
+//==============================================================================
+// Scalar kernels
+//==============================================================================
+
+namespace detail
+{
+    /** Type-punning copy (C++20's std::bit_cast); compiles to a register move. */
+    template <typename To, typename From>
+    inline To bitCast (From from)
+    {
+        static_assert(sizeof(To) == sizeof(From), "bitCast needs equal sizes");
+        To to;
+        std::memcpy(&to, &from, sizeof(To));
+        return to;
+    }
+
+    /** floor(x) for |x| < 2^31; unlike std::floor this vectorises without -ffast-math. */
+    inline float floorSmall (float x)
+    {
+        auto i = (std::int32_t) x;
+        i -= (x < (float) i);
+        return (float) i;
+    }
+
+    /** sin(2 pi x) for x already reduced to [-0.5, 0.5]. */
+    inline float sin2PiReduced (float r)
+    {
+        // fold onto the quarter wave [-0.25, 0.25]
+        const float a = 0.25f - std::abs(std::abs(r) - 0.25f);
+        const float x = std::copysign(1.0f, r) * a;
+        const float x2 = x * x;
+
+        return x * (6.283185302f + x2 * (-41.34169186f + x2 * (81.60326573f
+                 + x2 * (-76.59820792f + x2 * 39.87323178f))));
+    }
+
+    /** 2^(n + f) for integral n in [-126, 127] and f in [0, 1]. */
+    inline float exp2Split (float n, float f)
+    {
+        // p(0) == 1 exactly, so integral powers of two are exact
+        const float p = 1.0f + f * (0.6931513118f + f * (0.2401644502f
+                      + f * (0.05579991311f + f * (0.009017030316f + f * 0.001867130072f))));
+
+        return p * bitCast<float>((std::int32_t) (n + 127.0f) << 23);
+    }
+
+    /** Reduces radians to turns in [-0.5, 0.5] (two-step 2 pi, exact for |x| < 2^12). */
+    inline float radiansToReducedTurns (float radians)
+    {
+        const float k = floorSmall(radians * 0.15915494309f + 0.5f);
+        const float r = (radians - k * 6.28125f) - k * 0.0019353071795864769f;
+        return r * 0.15915494309f;
+    }
+
+    inline float exp2Unclamped (float x)
+    {
+        const float n = floorSmall(x);
+        return exp2Split(n, x - n);
+    }
+
+    inline float expUnclamped (float x)
+    {
+        // split off n ln2 in two steps so large |x| keeps full precision
+        const float n = floorSmall(x * 1.44269504089f);
+        const float r = (x - n * 0.693359375f) + n * 2.12194440e-4f;
+        return exp2Split(n, r * 1.44269504089f);
+    }
+
+    inline float semitonesToRatioUnclamped (float semitones)
+    {
+        // whole octaves split off exactly so large intervals keep full precision
+        const float octaves = floorSmall(semitones * (1.0f / 12.0f));
+        const float rem = semitones - octaves * 12.0f;
+        return exp2Split(octaves, rem * (1.0f / 12.0f));
+    }
+
+    /** Clamps in a pass of its own: fused into the kernel loop, GCC keeps the
+        compares as branches under -ftrapping-math and gives up vectorising. */
+    inline void clampBlock (float* out, const float* in, int numSamples, float lo, float hi)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            out[i] = std::min(std::max(in[i], lo), hi);
+    }
+}
+
+/** sin(2 pi x), x in turns. */
+inline float sin2Pi (float turns)
+{
+    return detail::sin2PiReduced(turns - detail::floorSmall(turns + 0.5f));
+}
+
+/** cos(2 pi x), x in turns. */
+inline float cos2Pi (float turns)
+{
+    const float r = turns - detail::floorSmall(turns + 0.5f);
+    return detail::sin2PiReduced(0.25f - std::abs(r));
+}
+
+inline float sin (float radians)
+{
+    return detail::sin2PiReduced(detail::radiansToReducedTurns(radians));
+}
+
+inline float cos (float radians)
+{
+    const float r = detail::radiansToReducedTurns(radians);
+    return detail::sin2PiReduced(0.25f - std::abs(r));
+}
+
+/** 2^x, x clamped to [-126, 127]. */
+inline float exp2 (float x)
+{
+    return detail::exp2Unclamped(std::min(std::max(x, -126.0f), 127.0f));
+}
+
+/** e^x, x clamped to [-87, 88]. */
+inline float exp (float x)
+{
+    return detail::expUnclamped(std::min(std::max(x, -87.0f), 88.0f));
+}
+
+/** log2(x) for positive normal x. */
+inline float log2 (float x)
+{
+    // split so the mantissa lands in [sqrt(0.5), sqrt(2))
+    const auto bits = detail::bitCast<std::int32_t>(x);
+    const std::int32_t e = (bits - 0x3f3504f3) >> 23;
+    const float m = detail::bitCast<float>(bits - (e << 23));
+
+    const float s = (m - 1.0f) / (m + 1.0f);
+    const float s2 = s * s;
+
+    return (float) e + s * (2.885391289f + s2 * (0.9614708090f + s2 * 0.5989738857f));
+}
+
+/** Frequency ratio of an interval in semitones, 2^(semitones / 12), clamped to [-1512, 1524]. */
+inline float semitonesToRatio (float semitones)
+{
+    return detail::semitonesToRatioUnclamped(std::min(std::max(semitones, -1512.0f), 1524.0f));
+}
+
+//==============================================================================
+// Block kernels (out may alias in)
+//==============================================================================
+
+inline void sin2PiBlock (float* out, const float* turns, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+        out[i] = sin2Pi(turns[i]);
+}
+
+inline void cos2PiBlock (float* out, const float* turns, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+        out[i] = cos2Pi(turns[i]);
+}
+
+inline void exp2Block (float* out, const float* x, int numSamples)
+{
+    detail::clampBlock(out, x, numSamples, -126.0f, 127.0f);
+    for (int i = 0; i < numSamples; ++i)
+        out[i] = detail::exp2Unclamped(out[i]);
+}
+
+inline void expBlock (float* out, const float* x, int numSamples)
+{
+    detail::clampBlock(out, x, numSamples, -87.0f, 88.0f);
+    for (int i = 0; i < numSamples; ++i)
+        out[i] = detail::expUnclamped(out[i]);
+}
+
+inline void log2Block (float* out, const float* x, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+        out[i] = log2(x[i]);
+}
+
+inline void semitonesToRatioBlock (float* out, const float* semitones, int numSamples)
+{
+    detail::clampBlock(out, semitones, numSamples, -1512.0f, 1524.0f);
+    for (int i = 0; i < numSamples; ++i)
+        out[i] = detail::semitonesToRatioUnclamped(out[i]);
+}
+
+} // namespace SchillingerEcosystem::DSP::FastMath
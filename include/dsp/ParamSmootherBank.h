@@ -0,0 +1,141 @@
+/*
+ * ParamSmootherBank.h
+ *
+ * Block-rate linear smoothing for a fixed set of parameters
+ * - Same ramp as juce::SmoothedValue<float, Linear>: a new target is reached
+ *   in a fixed number of samples
+ * - Every parameter's ramp state sits in one aligned array and advance()
+ *   moves them all a whole block at a time
+ * - Per-sample values are written only for parameters that are moving;
+ *   settled ones are a single constant (getCurrent) that render loops can
+ *   hoist out of the sample loop
+ *
+ * Created: October 16, 2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+template <int NumParams, int MaxBlockSize>
+class ParamSmootherBank
+{
+public:
+    static_assert(NumParams <= 32, "moving mask is 32 bits");
+
+    // Sets the ramp length and snaps to the current target
+    void reset (int index, double sampleRate, double rampSeconds)
+    {
+        rampLength[index] = (int) std::floor(rampSeconds * sampleRate);
+        setCurrentAndTarget(index, target[index]);
+    }
+
+    void setTarget (int index, float value)
+    {
+        if (value == target[index])
+            return;
+
+        if (rampLength[index] <= 0)
+        {
+            setCurrentAndTarget(index, value);
+            return;
+        }
+
+        target[index] = value;
+        countdown[index] = rampLength[index];
+        step[index] = (target[index] - current[index]) / (float) countdown[index];
+    }
+
+    // One-off ramp length, e.g. the interval between timestamped controller values
+    void setTarget (int index, float value, int rampSamples)
+    {
+        if (rampSamples <= 0)
+        {
+            setCurrentAndTarget(index, value);
+            return;
+        }
+
+        target[index] = value;
+        countdown[index] = rampSamples;
+        step[index] = (target[index] - current[index]) / (float) rampSamples;
+    }
+
+    void setCurrentAndTarget (int index, float value)
+    {
+        current[index] = target[index] = value;
+        step[index] = 0.0f;
+        countdown[index] = 0;
+    }
+
+    void snapAllToTarget()
+    {
+        for (int p = 0; p < NumParams; ++p)
+            setCurrentAndTarget(p, target[p]);
+    }
+
+    float getTarget (int index) const  { return target[index]; }
+    float getCurrent (int index) const { return current[index]; }   // value at the end of the last block
+    bool isSmoothing (int index) const { return countdown[index] > 0; }
+
+    // Moves every ramp on by numSamples (<= MaxBlockSize) and fills the ramp
+    // buffer of each parameter that was moving. Returns those as a bit mask.
+    std::uint32_t advance (int numSamples)
+    {
+        movingMask = 0;
+
+        for (int p = 0; p < NumParams; ++p)
+        {
+            if (countdown[p] <= 0)
+                continue;
+
+            movingMask |= 1u << p;
+
+            float* ramp = ramps[p];
+            const int numRamping = std::min(numSamples, countdown[p]);
+            const float start = current[p];
+            const float inc = step[p];
+
+            for (int i = 0; i < numRamping; ++i)
+                ramp[i] = start + inc * (float) (i + 1);
+
+            std::fill(ramp + numRamping, ramp + numSamples, target[p]);
+
+            countdown[p] -= numRamping;
+            current[p] = (countdown[p] > 0) ? ramp[numSamples - 1] : target[p];
+        }
+
+        return movingMask;
+    }
+
+    // Whether the parameter(s) moved during the last advance()
+    bool isMoving (int index) const           { return (movingMask >> index) & 1u; }
+    bool isAnyMoving (std::uint32_t mask) const { return (movingMask & mask) != 0; }
+
+    // Value of a parameter at sample i of the last advance()
+    float getValue (int index, int i) const
+    {
+        return isMoving(index) ? ramps[index][i] : current[index];
+    }
+
+    // Per-sample values for the last advance(). Settled parameters are filled
+    // with their constant on request, so only call this on ramping paths.
+    const float* getRamp (int index, int numSamples)
+    {
+        if (! isMoving(index))
+            std::fill(ramps[index], ramps[index] + numSamples, current[index]);
+
+        return ramps[index];
+    }
+
+private:
+    alignas(32) float current[NumParams] {};
+    alignas(32) float target[NumParams] {};
+    alignas(32) float step[NumParams] {};
+    int countdown[NumParams] {};
+    int rampLength[NumParams] {};
+    std::uint32_t movingMask = 0;
+
+    alignas(32) float ramps[NumParams][MaxBlockSize] {};
+};
@@ -0,0 +1,69 @@
+/*
+ * BreathLeadSynth.h
+ *
+ * JUCE Synthesiser hosting BreathLead voices
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "voice/BreathLeadVoice.h"
+#include "voice/BreathLeadLaneVoice.h"
+#include "dsp/BreathLeadLanes.h"
+#include "dsp/BreathControllerInput.h"
+#include <cstdint>
+
+class BreathLeadSynth : public juce::Synthesiser
+{
+public:
+    enum class VoiceMode
+    {
+        mono,    // one scalar BreathLeadVoice
+        unison,  // one note drives all lanes, detuned and spread
+        poly     // one lane per note
+    };
+
+    explicit BreathLeadSynth (juce::AudioProcessorValueTreeState& apvtsRef,
+                              VoiceMode mode = VoiceMode::mono);
+
+    void prepare (double sampleRate, int samplesPerBlock, int numChannels);
+    void reset();
+
+    VoiceMode getVoiceMode() const { return voiceMode; }
+
+    // Per-sample breath pressure (0..1) for the next renderNextBlock;
+    // pressure[0] belongs to buffer sample firstSample (its startSample), so
+    // a host block can be rendered in chunks from one short buffer. nullptr
+    // returns to velocity / mod-wheel pressure. Must stay valid for that block.
+    void setBreathPressure (const float* pressure, int firstSample = 0);
+
+    // MIDI 2.0-style 32-bit value for controller 1, 2 or 11 (others are
+    // ignored). Call between render calls; it is stamped with the synth's
+    // sample clock like the 14-bit CCs arriving in the MIDI buffer.
+    void handleHighResController (int controllerNumber, std::uint32_t value);
+
+    // CC1/33, CC2/34 and CC11/43 are decoded here (14-bit, timestamped, ramped)
+    // and sent to every voice; everything else goes to juce::Synthesiser
+    void handleController (int midiChannel, int controllerNumber, int controllerValue) override;
+
+protected:
+    void renderVoices (juce::AudioBuffer<float>& outputAudio, int startSample, int numSamples) override;
+
+private:
+    void updateLaneParamsFromAPVTS();
+    void applyController (const BreathControllerInput::Update& update);
+
+    BreathLeadParamSnapshot params;   // shared by every voice; must precede them
+    VoiceMode voiceMode = VoiceMode::mono;
+
+    BreathLeadLanes lanes;
+    BreathLeadParamSnapshot::Reader laneParamReader;
+
+    const float* breathPressure = nullptr;
+    int breathPressureStart = 0;   // buffer sample of breathPressure[0]
+
+    BreathControllerInput controllerInput;
+    std::int64_t sampleClock = 0; // samples rendered so far; MIDI events land at this time
+};
@@ -0,0 +1,40 @@
+/*
+ * BreathLeadLaneVoice.h
+ *
+ * SynthesiserVoice that drives one or more lanes of a shared BreathLeadLanes
+ * engine. Audio is rendered once for all lanes by BreathLeadSynth; this voice
+ * only handles note/expression events and voice lifetime.
+ *
+ * Created: October 16, 2026
+ */
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "dsp/BreathLeadLanes.h"
+
+class BreathLeadLaneVoice : public juce::SynthesiserVoice
+{
+public:
+    // laneMask: bit n set = this voice plays lane n
+    BreathLeadLaneVoice (BreathLeadLanes& lanesRef, unsigned laneMask);
+
+    // Per-lane pitch ratio (unison detune), applied on note-on
+    void setLaneDetuneCents (int lane, float cents);
+
+    bool canPlaySound (juce::SynthesiserSound* s) override;
+
+    void startNote (int midiNoteNumber, float vel, juce::SynthesiserSound*, int) override;
+    void stopNote (float, bool allowTailOff) override;
+
+    void pitchWheelMoved (int newPitchWheelValue) override;
+    void controllerMoved (int controllerNumber, int newControllerValue) override;
+    void aftertouchChanged (int newAftertouchValue) override;
+
+    void renderNextBlock (juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override;
+
+private:
+    BreathLeadLanes& lanes;
+    unsigned mask = 0;
+    float detuneRatio[BreathLeadLanes::numLanes];
+};
@@ -0,0 +1,71 @@
+/*
+ * BreathLeadVoice.h
+ *
+ * JUCE SynthesiserVoice wrapping BreathLeadDSP
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "BreathLeadParams.h"
+#include "dsp/BreathLeadDSP.h"
+
+class BreathLeadVoice : public juce::SynthesiserVoice
+{
+public:
+    explicit BreathLeadVoice (BreathLeadParamSnapshot& paramsRef);
+
+    bool canPlaySound (juce::SynthesiserSound* s) override;
+    void setCurrentPlaybackSampleRate (double newRate) override;
+
+    void startNote (int midiNoteNumber, float vel, juce::SynthesiserSound*, int) override;
+    void stopNote (float, bool allowTailOff) override;
+
+    void pitchWheelMoved (int newPitchWheelValue) override;
+    void controllerMoved (int controllerNumber, int newControllerValue) override;
+    void aftertouchChanged (int newAftertouchValue) override;
+
+    void renderNextBlock (juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override;
+
+    // Breath pressure for the synth's current block; pressure[0] is
+    // outputBuffer sample firstSample (nullptr = pressure from velocity / mod wheel)
+    void setBreathPressure (const float* pressure, int firstSample)
+    {
+        breathPressure = pressure;
+        breathPressureStart = firstSample;
+    }
+
+    // Ramped controller value from BreathLeadSynth's high-resolution input
+    void setController (BreathController controller, float value01, int rampSamples)
+    {
+        dsp.setController(controller, value01, rampSamples);
+    }
+
+private:
+    float coeffFromMs (float ms) const;
+    void updateParamsFromAPVTS();
+
+    BreathLeadParamSnapshot& params;
+    BreathLeadParamSnapshot::Reader paramReader;
+    BreathLeadDSP dsp;
+
+    double sr = 48000.0;
+
+    // glide
+    float portamentoMs = 30.0f;
+    float glideCoeff = 0.0f;
+    float targetHz = 220.0f;
+    float currentHz = 220.0f;
+
+    // per-block pitch curve handed to dsp.renderBlock
+    float glideHz[BreathLeadDSP::maxChunkSize] {};
+
+    const float* breathPressure = nullptr;
+    int breathPressureStart = 0;
+
+    // performance controls
+    float pitchBendNorm = 0.0f;
+    float aftertouch01 = 0.0f;
+};
@@ -24,6 +24,7 @@
 #pragma once
 
 #include "../../../../include/dsp/InstrumentDSP.h"
+#include "ParameterRegistry.h"
 #include <vector>
 #include <array>
 #include <memory>
@@ -37,6 +38,7 @@ namespace DSP {
 // Forward Declarations
 //==============================================================================
 
+class AetherPureDSP;
 class AetherVoiceManager;
 class Pedalboard;
 class SharedBridgeCoupling;
@@ -518,6 +520,12 @@ public:
     int getActiveVoiceCount() const override;
     int getMaxPolyphony() const override { return 6; }
 
+    // Parameter table index of an id (-1 if unknown)
+    int getParameterIndex(const char* paramId) const { return parameterRegistry.indexOf(paramId); }
+    int getNumParameters() const { return parameterRegistry.size; }
+    float getParameterValue(int index) const;
+    void setParameterValue(int index, float value);
+
     const char* getInstrumentName() const override { return "MotionAether"; }
     const char* getInstrumentVersion() const override { return "2.0.0"; }
 
@@ -554,6 +562,24 @@ public:
     } params_;
 
 private:
+    // Host-addressable parameters; ids match the preset keys
+    static constexpr ParameterDescriptor parameterDescriptors[] = {
+        // id                    offset                                      type                    min     max     default  smoothing
+        { "masterVolume",        offsetof(Parameters, masterVolume),         ParameterType::DOUBLE,  0.0f,   4.0f,   3.0f,    0.02f },
+        { "damping",             offsetof(Parameters, damping),              ParameterType::DOUBLE,  0.0f,   1.0f,   0.996f,  0.02f },
+        { "brightness",          offsetof(Parameters, brightness),           ParameterType::DOUBLE,  0.0f,   1.0f,   0.5f,    0.02f },
+        { "stiffness",           offsetof(Parameters, stiffness),            ParameterType::DOUBLE,  0.0f,   1.0f,   0.0f,    0.02f },
+        { "bridgeCoupling",      offsetof(Parameters, bridgeCoupling),       ParameterType::DOUBLE,  0.0f,   1.0f,   0.6f,    0.02f },
+        { "nonlinearity",        offsetof(Parameters, nonlinearity),         ParameterType::DOUBLE,  0.0f,   1.0f,   0.1f,    0.02f },
+        { "dispersion",          offsetof(Parameters, dispersion),           ParameterType::DOUBLE,  0.0f,   1.0f,   0.5f,    0.02f },
+        { "sympatheticCoupling", offsetof(Parameters, sympatheticCoupling),  ParameterType::DOUBLE,  0.0f,   1.0f,   0.1f,    0.02f },
+        { "material",            offsetof(Parameters, material),             ParameterType::DOUBLE,  0.0f,   3.0f,   1.0f,    0.0f  },
+        { "bodyPreset",          offsetof(Parameters, bodyPreset),           ParameterType::INT,     0.0f,   2.0f,   0.0f,    0.0f  },
+    };
+
+    static constexpr auto parameterRegistry = makeParameterRegistry<Parameters>(parameterDescriptors);
+    static_assert(parameterRegistry.isPerfect(), "parameter ids must be unique");
+
     AetherVoiceManager voiceManager_;
     Pedalboard pedalboard_;
 
@@ -561,7 +587,8 @@ private:
     int blockSize_ = 512;
     double pitchBend_ = 0.0;
 
-    // Real-time safe temporary buffer for audio processing
+    // Real-time safe temporary buffer; process() renders in sub-blocks of
+    // this size, so any host block size works
     static constexpr int MAX_BLOCK_SIZE = 512;
     alignas(32) float tempBuffer_[MAX_BLOCK_SIZE];
 
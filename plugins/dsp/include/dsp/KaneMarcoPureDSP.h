@@ -9,13 +9,23 @@
     - Inherits from DSP::InstrumentDSP (no JUCE dependencies)
     - Headless operation (no GUI)
     - PolyBLEP anti-aliasing oscillators
+    - Alternative mip-mapped band-limited wavetable oscillator engine
     - WARP phase manipulation (-1.0 to +1.0)
+    - Unison: up to 16 detuned copies per oscillator in one vector kernel
     - FM synthesis with carrier/modulator swap
-    - 16-slot modulation matrix with lock-free std::atomic
-    - 8 macro controls (Serum-style)
-    - SVF multimode filter
-    - 16-voice polyphony with monophonic/legato modes
-    - JSON preset save/load system
+    - 16-slot modulation matrix with lock-free std::atomic, compiled into a
+      flat route list and evaluated per voice at control rate
+    - 8 macro controls (Serum-style), routed by parameter index at block rate
+    - Zero-delay-feedback SVF multimode filter, cutoff modulated by the
+      filter envelope, key and velocity tracking
+    - Segment ADSR envelopes: per-stage increments, block rendering
+    - 1-128 voice polyphony (set before prepare) with monophonic/legato modes
+    - O(1) voice allocation: free list, active list, note map, steal queues
+    - Struct-of-arrays voice lanes: 8 voices rendered per pass with SIMD
+    - Constexpr parameter table with perfect-hash id lookup; get/set by
+      index and JSON preset save/load are generated from it
+    - Sample-accurate automation through a lock-free SPSC event queue, with
+      per-parameter ramps
     - Factory-creatable for dynamic instantiation
 
   ==============================================================================
@@ -24,6 +34,8 @@
 #pragma once
 
 #include "../../../../include/dsp/InstrumentDSP.h"
+#include "ParameterRegistry.h"
+#include "ParameterEventQueue.h"
 #include <vector>
 #include <array>
 #include <memory>
@@ -31,7 +43,9 @@
 #include <functional>
 #include <algorithm>
 #include <atomic>
+#include <cstdint>
 #include <random>
+#include <thread>
 
 // Forward declaration for UPFS namespace
 namespace UPFS {
@@ -48,6 +62,7 @@ class VoiceManager;
 class ModulationMatrix;
 class MacroSystem;
 class MotionPureDSP;
+struct VoiceLaneGroup;
 
 //==============================================================================
 // Oscillator with PolyBLEP Anti-Aliasing
@@ -55,6 +70,56 @@ class MotionPureDSP;
 
 enum class Waveform { SAW, SQUARE, TRIANGLE, SINE, PULSE };
 
+// POLYBLEP computes each waveform per sample; WAVETABLE reads WavetableBank
+enum class OscillatorEngine { POLYBLEP, WAVETABLE };
+
+//==============================================================================
+// Band-Limited Wavetables
+//==============================================================================
+
+/**
+ * @brief Mip-mapped band-limited tables for every waveform and warp setting
+ *
+ * Built once, shared read-only by every oscillator. Each waveform has a set
+ * of tables per warp value (warp is phase distortion, so a warped cycle is
+ * just another periodic shape and can be band-limited up front), and each
+ * set holds one table per octave: level m keeps tableSize / 2^(m+1)
+ * harmonics, which stays below Nyquist up to a phase increment of
+ * 2^m / tableSize.
+ *
+ * PULSE is built from two SAW reads (its width is continuous), so only its
+ * warp is applied per sample.
+ */
+class WavetableBank
+{
+public:
+    static constexpr int tableSize = 2048;
+    static constexpr int numLevels = 11;    // 1024 harmonics down to 1
+    static constexpr int numWarpSets = 9;   // warp -1 to +1 in steps of 0.25
+    static constexpr int numShapes = 4;     // SAW, SQUARE, TRIANGLE, SINE
+
+    static const WavetableBank& getInstance();
+
+    // tableSize + 1 samples (the first repeated at the end for interpolation)
+    const float* getTable(Waveform shape, int warpSet, int level) const;
+
+    // Up to four tables and weights: the two warp sets around warp, each at
+    // the two octave levels around the phase increment
+    struct Selection
+    {
+        const float* tables[4] {};
+        float weights[4] {};
+    };
+
+    Selection select(Waveform shape, float warp, double phaseIncrement) const;
+
+private:
+    WavetableBank();
+
+    std::vector<float> tables_;
+};
+
+
 class Oscillator
 {
 public:
@@ -70,19 +135,30 @@ public:
     void setPulseWidth(float pw);
     void setFMDepth(float depth);
     void setIsFMCarrier(bool isCarrier);
+    void setEngine(OscillatorEngine newEngine);
 
     float processSample();
     float processSampleWithFM(float modulationInput);
 
-    double phase = 0.0;
-    double phaseIncrement = 0.0;
+    // Wavetable engine output at phase p (any range, FM offset included)
+    float renderWavetable(double p) const;
+
+    float phase = 0.0f;
+    float phaseIncrement = 0.0f;
     float warp = 0.0f;
     float pulseWidth = 0.5f;
     Waveform waveform = Waveform::SAW;
     bool isFMCcarrier = false;
     float fmDepth = 0.0f;
+    OscillatorEngine engine = OscillatorEngine::POLYBLEP;
 
 private:
+    // Table choice follows frequency, waveform and warp, so it is made when
+    // one of those changes rather than per sample
+    void updateWavetableSelection();
+
+    WavetableBank::Selection wavetable_;
+
     float generateWaveform(double p) const;
     float polyBlep(double t, double dt) const;
     float polyBlepSaw(double p) const;
@@ -91,6 +167,81 @@ private:
     float polyBlepPulse(double p, double pw) const;
 };
 
+//==============================================================================
+// Unison Oscillator Bank
+//==============================================================================
+
+/**
+ * @brief Up to maxVoices detuned copies of one Oscillator
+ *
+ * The copies take waveform, warp, pulse width, engine and FM depth from the
+ * oscillator they stand in for and differ only in pitch and phase. Phases
+ * and increments sit in aligned float arrays that every copy runs through
+ * with one branch-free PolyBLEP kernel, a block of copyBlock copies at a
+ * time (one AVX register each), so 16 copies cost two vector passes rather
+ * than sixteen oscillators.
+ *
+ * Detune ratios, the 1/sqrt(n) level and the per-copy pan gains are tables
+ * rebuilt when the count, detune or spread changes; a pitch change
+ * rescales the increments once. The wavetable engine picks one table
+ * selection per copy block (at the block's highest pitch) when pitch, shape
+ * or warp move, and interpolates the block's copies in one loop. Spread pans each copy by its detune
+ * position with a constant-power law, scaled so a centred copy keeps the
+ * mono level.
+ */
+class UnisonOscillator
+{
+public:
+    static constexpr int maxVoices = 16;
+    static constexpr int copyBlock = 8;
+    static constexpr float maxDetuneCents = 50.0f;   // outermost copies at detune 1
+
+    UnisonOscillator();
+
+    void reset();
+
+    // numVoices 1..maxVoices (1 = off, the oscillator plays alone); detune
+    // and spread 0..1 (spread 0 = every copy centred)
+    void setVoices(int numVoices, float detune, float spread = 0.0f);
+
+    bool isActive() const { return numVoices_ > 1; }
+    bool isStereo() const { return numVoices_ > 1 && spread_ > 0.0f; }
+    int getNumVoices() const { return numVoices_; }
+
+    // Sum of the copies around osc's pitch; phaseOffset carries FM
+    float processSample(const Oscillator& osc, float phaseOffset);
+
+    // The same copies through their pan gains
+    void processStereoSample(const Oscillator& osc, float phaseOffset, float& left, float& right);
+
+private:
+    void updateIncrements(float centreIncrement);
+
+    // Every copy's output for this sample into out (numBlocks_ * copyBlock
+    // entries); the caller's gain loop moves the phases on
+    void renderCopies(const Oscillator& osc, float phaseOffset, float* out);
+    void updateTables(Waveform shape, float warp);
+
+    int numVoices_ = 1;
+    int numBlocks_ = 0;
+    float detune_ = 0.0f;
+    float spread_ = 0.0f;
+    float centreIncrement_ = 0.0f;
+
+    alignas(32) float phase_[maxVoices] {};
+    alignas(32) float increment_[maxVoices] {};
+    alignas(32) float invIncrement_[maxVoices] {};
+    alignas(32) float ratio_[maxVoices] {};
+    alignas(32) float gain_[maxVoices] {};
+    alignas(32) float gainLeft_[maxVoices] {};
+    alignas(32) float gainRight_[maxVoices] {};
+
+    WavetableBank::Selection blockTables_[maxVoices / copyBlock];
+    Waveform tableShape_ = Waveform::SAW;
+    float tableWarp_ = 0.0f;
+    bool tablesValid_ = false;
+};
+
 //==============================================================================
 // Sub-Oscillator (-1 Octave Square Wave)
 //==============================================================================
@@ -110,12 +261,13 @@ public:
 
     float processSample();
 
-    double phase = 0.0;
+    float phase = 0.0f;
     bool enabled = true;
     float level = 0.5f;
 
 private:
-    double phaseIncrement = 0.0f;
+    friend struct VoiceLaneGroup;
+    float phaseIncrement = 0.0f;
 };
 
 //==============================================================================
@@ -133,6 +285,7 @@ public:
 
     float nextFloat();
     void setLevel(float level) { level_ = level; }
+    void setSeed(std::uint32_t seed) { generator_.seed(seed); }
 
 private:
     float level_ = 0.0f;
@@ -146,6 +299,16 @@ private:
 
 enum class FilterType { LOWPASS, HIGHPASS, BANDPASS, NOTCH };
 
+/**
+ * @brief Zero-delay-feedback (trapezoidal) state variable filter
+ *
+ * Stable at any cutoff and resonance. The coefficients are cached and only
+ * recomputed when the cutoff, resonance or modulation changes.
+ *
+ * Cutoff modulation is an offset in octaves set once per block: the
+ * frequency coefficient moves there on an exponential ramp (one multiply
+ * per sample), so a modulated filter only adds the damping update.
+ */
 class SVFFilter
 {
 public:
@@ -159,24 +322,63 @@ public:
     void setCutoff(float freqHz);
     void setResonance(float res);
 
+    // Moves the cutoff to cutoff * 2^octaves over the next numSamples
+    void setModulation(float octaves, int numSamples);
+
     float processSample(float input);
 
+    // Left and right through the same coefficients, each with its own
+    // integrators (processSample keeps the right ones in step with the left)
+    void processStereoSample(float& left, float& right);
+
     FilterType type = FilterType::LOWPASS;
     float cutoff = 1000.0f;
     float resonance = 0.5f;
 
 private:
+    friend struct VoiceLaneGroup;
+
+    float frequencyCoefficient(float octaves) const;
+    void updateCoefficients();
+    void updateGains();
+    float integrate(float input, float& ic1, float& ic2) const;
+
     double sampleRate_ = 48000.0;
-    float v0 = 0.0f;  // Input
-    float v1 = 0.0f;  // Lowpass
-    float v2 = 0.0f;  // Bandpass
-    float v3 = 0.0f;  // Highpass
+    float modulationOctaves = 0.0f;
+
+    // g = tan(pi * fc / fs), k = damping (1 / Q), a1..a3 from both
+    float g = 0.0f;
+    float k = 1.0f;
+    float a1 = 1.0f;
+    float a2 = 0.0f;
+    float a3 = 0.0f;
+
+    // Exponential ramp of g: multiplied by gRatio for rampSamples samples,
+    // the last one landing on gTarget
+    float gTarget = 0.0f;
+    float gRatio = 1.0f;
+    int rampSamples = 0;
+
+    // Integrator states
+    float ic1eq = 0.0f;
+    float ic2eq = 0.0f;
+    float ic1eqRight = 0.0f;
+    float ic2eqRight = 0.0f;
 };
 
 //==============================================================================
 // ADSR Envelope
 //==============================================================================
 
+/**
+ * @brief Linear ADSR built from segments
+ *
+ * Each ramp stage is a segment planned when it starts: the per-sample
+ * increment (taken from the stage time when the parameters change) and the
+ * number of samples until the stage ends. processBlock renders a segment as
+ * one straight loop and fills sustain and idle with a constant;
+ * processSample gives the same values one at a time.
+ */
 class Envelope
 {
 public:
@@ -199,16 +401,41 @@ public:
     void noteOff();
 
     float processSample();
+    void processBlock(float* output, int numSamples);
+
+    // Moves on numSamples without rendering them; returns the level reached
+    float advance(int numSamples);
+
     bool isActive() const;
+    float getLevel() const { return currentLevel; }
 
     Parameters params;
     float amount = 1.0f;  // Envelope depth
 
 private:
     enum class State { IDLE, ATTACK, DECAY, SUSTAIN, RELEASE };
+
+    void updateIncrements();
+    void startStage(State newState);
+    void endSegment();
+
     State state = State::IDLE;
     float currentLevel = 0.0f;
     double sampleRate_ = 48000.0;
+
+    // Per-sample change of each ramp stage
+    float attackIncrement = 0.0f;
+    float decayIncrement = 0.0f;
+    float releaseIncrement = 0.0f;
+
+    // Current ramp: sample n (1..segmentLength) of the stage is
+    // segmentStart + segmentStep * n, the last one landing on segmentTarget.
+    // segmentLength is 0 while sustaining or idle.
+    float segmentStart = 0.0f;
+    float segmentStep = 0.0f;
+    float segmentTarget = 0.0f;
+    int segmentLength = 0;
+    int segmentPosition = 0;
 };
 
 //==============================================================================
@@ -233,6 +460,10 @@ public:
 
     float processSample();
 
+    // Control-rate step: the value at the start of the span (as
+    // processSample), then the phase moves on by numSamples
+    float advance(int numSamples);
+
     float rate = 5.0f;
     float depth = 0.5f;
     LFOWaveform waveform = LFOWaveform::SINE;
@@ -270,16 +501,29 @@ enum class ModDestination {
     LFO1_RATE, LFO1_DEPTH, LFO2_RATE, LFO2_DEPTH
 };
 
+constexpr int numModSources = static_cast<int>(ModSource::MACRO_8) + 1;
+constexpr int numModDestinations = static_cast<int>(ModDestination::LFO2_DEPTH) + 1;
+
 struct ModulationSlot
 {
     ModSource source = ModSource::LFO1;
     ModDestination destination = ModDestination::OSC1_FREQ;
     std::atomic<float> amount{0.0f};
-    bool bipolar = true;
+    bool bipolar = true;    // false maps bipolar sources (LFOs, pitch wheel) to 0..1
     int curveType = 0;  // 0=Linear, 1=Exponential
     float maxValue = 1.0f;
 };
 
+// One active slot, flattened for the audio thread
+struct ModRoute
+{
+    int source = 0;
+    int destination = 0;
+    float amount = 0.0f;
+    bool toUnipolar = false;
+    int curveType = 0;
+};
+
 class ModulationMatrix
 {
 public:
@@ -297,8 +541,26 @@ public:
 
     void processModulationSources();
 
+    // Rebuilds the route list from the slots: only slots with a non-zero
+    // amount and a destination the voices render are kept. Called by
+    // setSlot; call it after changing slots directly.
+    void compile();
+    int getNumRoutes() const { return numRoutes_; }
+    const ModRoute& getRoute(int index) const { return routes_[index]; }
+
+    // Moves the LFOs on by one control block and stores their values
+    void advanceSources(int numSamples);
+
+    // Sums every route into destinations (numModDestinations values) for
+    // one voice; sources holds numModSources values with the per-voice
+    // ones (velocity, envelopes) filled in
+    void evaluate(const float* sources, float* destinations) const;
+
+    // Destinations VoiceManager::applyModulation writes to each voice
+    static bool isVoiceDestination(ModDestination destination);
+
     std::array<std::atomic<float>, 16> modulationAmounts;
-    float sourceValues[16];  // Updated each sample
+    float sourceValues[16];  // Updated each control block
     std::array<ModulationSlot, 16> slots;
 
     LFO lfo1;
@@ -306,6 +568,9 @@ public:
 
 private:
     float applyCurve(float value, int curveType) const;
+
+    std::array<ModRoute, 16> routes_;
+    int numRoutes_ = 0;
 };
 
 //==============================================================================
@@ -315,6 +580,7 @@ private:
 struct MacroDestination
 {
     std::string paramID;
+    int paramIndex = -1;        // MotionPureDSP parameter table index, resolved when added
     float amount = 0.0f;
     float minValue = 0.0f;
     float maxValue = 1.0f;
@@ -328,9 +594,22 @@ struct MacroControl
     int numDestinations = 0;
 };
 
+/**
+ * @brief Macro knobs and their parameter destinations
+ *
+ * Destinations are resolved to parameter table indices when they are added
+ * and compiled into a dense routing table: one entry per modulated
+ * parameter, each pointing at the macros that drive it. Evaluation is then
+ * a multiply-add per route with no string work, cheap enough to run at
+ * block rate.
+ */
 class MacroSystem
 {
 public:
+    static constexpr int numMacros = 8;
+    static constexpr int maxDestinations = 4;
+    static constexpr int maxRoutes = numMacros * maxDestinations;
+
     MacroSystem();
     ~MacroSystem() = default;
 
@@ -340,12 +619,47 @@ public:
     void setMacroName(int macroIndex, const std::string& name);
     std::string getMacroName(int macroIndex) const;
 
+    // Unknown parameter ids are ignored
     void addDestination(int macroIndex, const std::string& paramID,
                        float amount, float minVal, float maxVal);
+    void addDestination(int macroIndex, int paramIndex,
+                       float amount, float minVal, float maxVal);
+    void clearDestinations(int macroIndex);
 
+    // Offset the macros add to one parameter at their current values
+    float getModulation(int paramIndex) const;
+    float applyMacroModulation(int paramIndex, float baseValue) const { return baseValue + getModulation(paramIndex); }
     float applyMacroModulation(const std::string& paramID, float baseValue) const;
 
-    std::array<MacroControl, 8> macros;
+    // Every macro-modulated parameter and its offset, at block rate.
+    // Writes up to maxRoutes entries and returns how many.
+    int evaluate(int* paramIndices, float* offsets) const;
+
+    // Distinct parameters one macro drives (up to maxDestinations)
+    int getDestinations(int macroIndex, int* paramIndices) const;
+    int getNumModulatedParameters() const { return numTargets_; }
+
+    std::array<MacroControl, numMacros> macros;
+
+private:
+    void compileRoutes();
+
+    struct Route
+    {
+        int macro = 0;
+        float scale = 0.0f;     // amount * (maxValue - minValue)
+    };
+
+    struct Target
+    {
+        int paramIndex = -1;
+        int firstRoute = 0;
+        int numRoutes = 0;
+    };
+
+    Route routes_[maxRoutes];
+    Target targets_[maxRoutes];
+    int numTargets_ = 0;
 };
 
 //==============================================================================
@@ -357,6 +671,10 @@ struct Voice
     Oscillator osc1;
     Oscillator osc2;
     SubOscillator subOsc;
+
+    // Detuned copies standing in for osc1 / osc2 in the mix when active
+    UnisonOscillator osc1Unison;
+    UnisonOscillator osc2Unison;
     NoiseGenerator noiseGen;
 
     SVFFilter filter;
@@ -367,10 +685,10 @@ struct Voice
     MacroSystem* macros = nullptr;
 
     // Voice parameters
-    bool active = false;
+    bool active = false;         // key held; envelopes may still run after release
     int midiNote = 0;
     float velocity = 0.0f;
-    double startTime = 0.0;
+    double startTime = 0.0;      // seconds, stamped by VoiceManager at note-on
 
     // Oscillator levels
     float osc1Level = 0.7f;
@@ -379,7 +697,16 @@ struct Voice
     float noiseLevel = 0.0f;
 
     // Filter parameters
-    float filterEnvelopeAmount = 0.0f;
+    float filterEnvelopeAmount = 0.0f;   // -1..1 of filterEnvelopeOctaves
+    float filterKeyTrack = 0.0f;         // 1 = cutoff follows the keyboard around middle C
+    float filterVelocityTrack = 0.0f;    // 1 = a zero-velocity note is velocityTrackOctaves darker
+
+    static constexpr float filterEnvelopeOctaves = 5.0f;
+    static constexpr float velocityTrackOctaves = 4.0f;
+
+    // Filter envelope, key and velocity tracking are applied to the cutoff
+    // as one ramp per chunk of this many samples
+    static constexpr int filterModulationChunk = 64;
 
     // FM synthesis
     bool fmEnabled = false;
@@ -389,6 +716,17 @@ struct Voice
     // Pan
     float pan = 0.0f;
 
+    // xorshift32 noise state used when the voice renders in a lane group
+    std::uint32_t laneNoiseState = 0x9E3779B9u;
+
+    // Modulation matrix offsets to osc1, osc2, sub and noise level. They
+    // ramp per sample to each control-rate evaluation; pitch, warp, pulse
+    // width and filter are set on the voice's modules once per control block.
+    enum { modOsc1Gain, modOsc2Gain, modSubGain, modNoiseGain, numModGains };
+    float modGain[numModGains] {};
+    float modGainStep[numModGains] {};
+    bool modulated = false;
+
     void prepare(double sampleRate);
     void reset();
 
@@ -396,7 +734,87 @@ struct Voice
     void noteOff(float vel);
 
     bool isActive() const;
-    float renderSample();
+
+    // Advances the filter envelope over the next numSamples (at most
+    // filterModulationChunk) and ramps the cutoff to match; renderSample
+    // then renders those samples
+    void updateFilterModulation(int numSamples);
+
+    // A stereo unison stack makes the voice stereo (filter and amp per
+    // side); otherwise left and right are the same
+    bool isStereo() const { return osc1Unison.isStereo() || osc2Unison.isStereo(); }
+    void renderSample(float& left, float& right);
+};
+
+//==============================================================================
+// Voice Lanes (Struct-of-Arrays Render State)
+//==============================================================================
+
+/**
+ * @brief Render state of up to 8 voices, one array slot per voice
+ *
+ * VoiceManager gathers the active voices into lane groups at the start of a
+ * block, renders each group voice-major (every stage runs across all lanes
+ * per sample, in fixed-width loops the compiler vectorises: 8 floats per
+ * AVX register) and scatters the state back at the end. The
+ * Voice objects stay the owners of note state between blocks.
+ *
+ * Voice parameters are set for every voice at once by
+ * VoiceManager::updateVoiceParameters, so they are read once per group.
+ * The ones the modulation matrix changes per voice (warp, pulse width,
+ * filter, level offsets) are gathered per lane. Envelopes stay in their
+ * Voice and are rendered a chunk at a time with Envelope::processBlock.
+ */
+struct alignas(64) VoiceLaneGroup
+{
+    static constexpr int numLanes = 8;
+
+    void gather(Voice* const* voicesIn, int count);
+    void scatter();
+
+    // Adds the group's mix to left and right; a null right folds a stereo
+    // group to mono in left
+    void render(float* left, float* right, int numSamples);
+
+    // Envelopes are rendered into the group (and the cutoff ramped) this
+    // many samples at a time
+    static constexpr int envelopeChunk = Voice::filterModulationChunk;
+
+    int numVoices = 0;
+    Voice* voices[numLanes] {};
+
+    // Oscillators: float phases in [0, 1), copied from and back to
+    // Oscillator / SubOscillator at gather and scatter
+    alignas(32) float osc1Phase[numLanes] {};
+    alignas(32) float osc1Inc[numLanes] {};
+    alignas(32) float osc2Phase[numLanes] {};
+    alignas(32) float osc2Inc[numLanes] {};
+    alignas(32) float subPhase[numLanes] {};
+    alignas(32) float subInc[numLanes] {};
+
+    // Per-voice modulated parameters
+    alignas(32) float osc1Warp[numLanes] {};
+    alignas(32) float osc2Warp[numLanes] {};
+    alignas(32) float osc1PulseWidth[numLanes] {};
+    alignas(32) float osc2PulseWidth[numLanes] {};
+    alignas(32) float modGain[Voice::numModGains][numLanes] {};
+    alignas(32) float modGainStep[Voice::numModGains][numLanes] {};
+    bool modulated = false;
+
+    // Filter (SVFFilter): coefficient ramp and integrators
+    alignas(32) float filterG[numLanes] {};
+    alignas(32) float filterGRatio[numLanes] {};
+    alignas(32) float filterGTarget[numLanes] {};
+    alignas(32) float filterK[numLanes] {};
+    alignas(32) float filterIc1[numLanes] {};
+    alignas(32) float filterIc2[numLanes] {};
+    alignas(32) float filterIc1Right[numLanes] {};
+    alignas(32) float filterIc2Right[numLanes] {};
+
+    // Amp envelope values for the current chunk, one row per lane
+    alignas(32) float ampEnvelope[numLanes][envelopeChunk] {};
+
+    alignas(32) std::uint32_t noiseState[numLanes] {};
 };
 
 //==============================================================================
@@ -405,12 +823,37 @@ struct Voice
 
 enum class PolyphonyMode { POLY, MONO, LEGATO };
 
+// Scalar renders each Voice object per sample (reference path); Lanes
+// renders active voices 8 at a time through VoiceLaneGroup
+enum class VoiceRenderPath { Scalar, Lanes };
+
+/**
+ * @brief Voice pool with constant-time allocation
+ *
+ * The pool is sized in prepare() from the requested polyphony, and every
+ * bookkeeping structure is allocated there too:
+ * - free list: stack of idle voice indices
+ * - active list: compact indices of sounding voices (what gets rendered)
+ * - note map: MIDI note -> voice currently holding that key
+ * - steal queues: sounding voices in note-on order, released ones first,
+ *   so stealing takes the oldest released voice, else the oldest held one
+ *
+ * Voices whose envelopes have finished go back to the free list at the end
+ * of each block.
+ */
 class VoiceManager
 {
 public:
+    static constexpr int defaultPolyphony = 16;
+    static constexpr int maxPolyphony = 128;
+
     VoiceManager();
     ~VoiceManager() = default;
 
+    // Voice count used by the next prepare() (clamped to 1..maxPolyphony)
+    void setPolyphony(int numVoices);
+    int getPolyphony() const { return voices_.empty() ? requestedPolyphony_ : static_cast<int>(voices_.size()); }
+
     void prepare(double sampleRate, int samplesPerBlock);
     void reset();
 
@@ -421,20 +864,79 @@ public:
     void handleNoteOff(int note);
     void allNotesOff();
 
-    void processBlock(float* output, int numSamples, double sampleRate);
-    int getActiveVoiceCount() const;
+    // Renders the active voices into output (left) and outputRight; without
+    // outputRight, stereo voices are folded to mono
+    void processBlock(float* output, int numSamples, double sampleRate, float* outputRight = nullptr);
+    int getActiveVoiceCount() const { return numActive_; }
 
     void setPolyphonyMode(PolyphonyMode mode) { polyMode_ = mode; }
     PolyphonyMode getPolyphonyMode() const { return polyMode_; }
 
+    void setRenderPath(VoiceRenderPath path) { renderPath_ = path; }
+    VoiceRenderPath getRenderPath() const { return renderPath_; }
+
     void enableGlide(bool enable) { glideEnabled_ = enable; }
     void setGlideTime(float time) { glideTime_ = time; }
 
     // Update all voices with current parameters
     void updateVoiceParameters(const MotionPureDSP& synth);
 
+    // Push one parameter (table index) to every voice, touching only the
+    // voice state that reads it
+    void updateVoiceParameter(const MotionPureDSP& synth, int paramIndex);
+
+    // Evaluates the compiled routes for every sounding voice at the start of
+    // a control block of numSamples: gain offsets ramp across the block,
+    // pitch, warp, pulse width and filter are set for it
+    void applyModulation(const MotionPureDSP& synth, const ModulationMatrix& matrix, int numSamples);
+
 private:
-    std::array<Voice, 16> voices_;
+    void processBlockScalar(float* left, float* right, int numSamples);
+    void processBlockLanes(float* left, float* right, int numSamples);
+
+    // Voice state fed by the same parameters, updated together
+    enum class VoiceParameterGroup
+    {
+        None, Mix, FM, FilterTracking, Engine, Waveform, Warp, PulseWidth,
+        Unison, Filter, FilterEnvelope, AmpEnvelope, NumGroups
+    };
+
+    static VoiceParameterGroup groupOfParameter(int paramIndex);
+    static void updateVoiceGroup(Voice& voice, const MotionPureDSP& synth, VoiceParameterGroup group);
+
+    // Pool bookkeeping, all O(1)
+    int indexOf(const Voice* voice) const { return static_cast<int>(voice - voices_.data()); }
+    Voice* startVoice(int note, float velocity);
+    void releaseVoice(int index);
+    void retireFinishedVoices();
+    void queueAppend(int queue, int index);
+    void queueRemove(int index);
+
+    enum { heldQueue = 0, releasedQueue = 1, notQueued = -1 };
+
+    std::vector<Voice> voices_;
+    std::vector<VoiceLaneGroup> laneGroups_;
+    std::vector<Voice*> laneScratch_;
+
+    std::vector<int> freeList_;         // stack, numFree_ entries valid
+    std::vector<int> activeList_;       // numActive_ entries valid
+    std::vector<int> activeSlot_;       // voice -> position in activeList_ (-1 = free)
+    std::array<int, 128> noteToVoice_;  // held voice per MIDI note (-1 = none)
+
+    // Steal queues: doubly linked through queueNext_/queuePrev_
+    std::vector<int> queueNext_;
+    std::vector<int> queuePrev_;
+    std::vector<int> queueOf_;
+    int queueHead_[2] = { -1, -1 };
+    int queueTail_[2] = { -1, -1 };
+
+    int numFree_ = 0;
+    int numActive_ = 0;
+    int requestedPolyphony_ = defaultPolyphony;
+    std::int64_t sampleClock_ = 0;
+    bool modulationActive_ = false;
+
+    VoiceRenderPath renderPath_ = VoiceRenderPath::Lanes;
     PolyphonyMode polyMode_ = PolyphonyMode::POLY;
     int monoVoiceIndex_ = -1;
     bool glideEnabled_ = false;
@@ -461,13 +963,50 @@ public:
     void handleEvent(const ScheduledEvent& event) override;
 
     float getParameter(const char* paramId) const override;
+
+    // setParameter() and loadPreset() write at once on the audio thread, or
+    // before the first process(). From any other thread (the UI thread, a
+    // single producer) they queue their values, which land together at the
+    // start of the next process() call. loadPreset() returns false if the
+    // queue has no room for the whole preset.
     void setParameter(const char* paramId, float value) override;
 
     bool savePreset(char* jsonBuffer, int jsonBufferSize) const override;
     bool loadPreset(const char* jsonData) override;
 
     int getActiveVoiceCount() const override;
-    int getMaxPolyphony() const override { return 16; }
+    int getMaxPolyphony() const override { return voiceManager_.getPolyphony(); }
+
+    // Takes effect at the next prepare()
+    void setMaxPolyphony(int numVoices) { voiceManager_.setPolyphony(numVoices); }
+
+    // Samples per modulation matrix evaluation (1 to MAX_BLOCK_SIZE)
+    void setModulationControlRate(int samples) { controlRate_ = std::max(1, std::min(MAX_BLOCK_SIZE, samples)); }
+    int getModulationControlRate() const { return controlRate_; }
+
+    // Parameter table index of an id (-1 if unknown). Resolve once, then
+    // get/set by index with no string work.
+    static int getParameterIndex(const char* paramId) { return parameterRegistry.indexOf(paramId); }
+    static int getNumParameters() { return parameterRegistry.size; }
+    static const char* getParameterId(int index) { return parameterRegistry[index].id; }
+    float getParameterValue(int index) const;
+
+    // Direct write: call from the audio thread or while not processing
+    void setParameterValue(int index, float value);
+
+    // Automation from the host/UI thread (a single producer), lock-free.
+    // sampleOffset counts from the start of the process() call that picks the
+    // event up; offsets past its end carry over to the following calls.
+    // Returns false if the queue is full.
+    bool scheduleParameterChange(int index, float value, int sampleOffset = 0);
+
+    // Ramp automated parameters over their table smoothing time (default on)
+    void setParameterSmoothing(bool enabled) { parameterSmoothing_ = enabled; }
+
+    // Macro knobs are the macro_<n>_value parameters; each drives up to four
+    // destinations, offset by amount * knob * (maxVal - minVal)
+    void addMacroDestination(int macroIndex, const char* paramId, float amount, float minVal, float maxVal);
+    void clearMacroDestinations(int macroIndex);
 
     const char* getInstrumentName() const override { return "Motion"; }
     const char* getInstrumentVersion() const override { return "1.0.0"; }
@@ -486,6 +1025,9 @@ private:
         float osc1Detune = 0.0f;
         float osc1Pan = 0.0f;
         float osc1Level = 0.7f;
+        float osc1UnisonVoices = 1.0f;
+        float osc1UnisonDetune = 0.2f;
+        float osc1UnisonSpread = 0.0f;
 
         // OSC2
         float osc2Shape = 0.0f;
@@ -494,6 +1036,12 @@ private:
         float osc2Detune = 0.0f;
         float osc2Pan = 0.0f;
         float osc2Level = 0.5f;
+        float osc2UnisonVoices = 1.0f;
+        float osc2UnisonDetune = 0.2f;
+        float osc2UnisonSpread = 0.0f;
+
+        // Oscillator engine (0 = PolyBLEP, 1 = wavetable)
+        float oscEngine = 0.0f;
 
         // Sub
         float subEnabled = 1.0f;
@@ -545,7 +1093,7 @@ private:
         float modSource[16] = {0};
         float modDestination[16] = {0};
         float modAmount[16] = {0};
-        float modBipolar[16] = {1};
+        float modBipolar[16] = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
         float modCurve[16] = {0};
 
         // Macros (8 macros)
@@ -566,12 +1114,205 @@ private:
         double pitchBendRange = 2.0;
     } params_;
 
+    // Every named parameter (mod slots are addressed as mod_<slot>_<field>,
+    // see modSlotRegistry below). Defaults are the engine's init patch.
+    static constexpr ParameterDescriptor parameterDescriptors[] = {
+        // id                    offset                                      type                    min       max      default  smoothing
+        { "osc1_shape",          offsetof(Parameters, osc1Shape),            ParameterType::FLOAT,   0.0f,     4.0f,    0.0f,    0.0f  },
+        { "osc1_warp",           offsetof(Parameters, osc1Warp),             ParameterType::FLOAT,  -1.0f,     1.0f,    0.0f,    0.02f },
+        { "osc1_pulse_width",    offsetof(Parameters, osc1PulseWidth),       ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+        { "osc1_detune",         offsetof(Parameters, osc1Detune),           ParameterType::FLOAT,  -2400.0f,  2400.0f, 0.0f,    0.02f },
+        { "osc1_pan",            offsetof(Parameters, osc1Pan),              ParameterType::FLOAT,  -1.0f,     1.0f,    0.0f,    0.02f },
+        { "osc1_level",          offsetof(Parameters, osc1Level),            ParameterType::FLOAT,   0.0f,     1.0f,    0.7f,    0.02f },
+        { "osc1_unison_voices",  offsetof(Parameters, osc1UnisonVoices),     ParameterType::FLOAT,   1.0f,     16.0f,   1.0f,    0.0f  },
+        { "osc1_unison_detune",  offsetof(Parameters, osc1UnisonDetune),     ParameterType::FLOAT,   0.0f,     1.0f,    0.2f,    0.02f },
+        { "osc1_unison_spread",  offsetof(Parameters, osc1UnisonSpread),     ParameterType::FLOAT,   0.0f,     1.0f,    0.0f,    0.02f },
+
+        { "osc2_shape",          offsetof(Parameters, osc2Shape),            ParameterType::FLOAT,   0.0f,     4.0f,    1.0f,    0.0f  },
+        { "osc2_warp",           offsetof(Parameters, osc2Warp),             ParameterType::FLOAT,  -1.0f,     1.0f,    0.0f,    0.02f },
+        { "osc2_pulse_width",    offsetof(Parameters, osc2PulseWidth),       ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+        { "osc2_detune",         offsetof(Parameters, osc2Detune),           ParameterType::FLOAT,  -2400.0f,  2400.0f, 0.0f,    0.02f },
+        { "osc2_pan",            offsetof(Parameters, osc2Pan),              ParameterType::FLOAT,  -1.0f,     1.0f,    0.0f,    0.02f },
+        { "osc2_level",          offsetof(Parameters, osc2Level),            ParameterType::FLOAT,   0.0f,     1.0f,    0.6f,    0.02f },
+        { "osc2_unison_voices",  offsetof(Parameters, osc2UnisonVoices),     ParameterType::FLOAT,   1.0f,     16.0f,   1.0f,    0.0f  },
+        { "osc2_unison_detune",  offsetof(Parameters, osc2UnisonDetune),     ParameterType::FLOAT,   0.0f,     1.0f,    0.2f,    0.02f },
+        { "osc2_unison_spread",  offsetof(Parameters, osc2UnisonSpread),     ParameterType::FLOAT,   0.0f,     1.0f,    0.0f,    0.02f },
+
+        { "osc_engine",          offsetof(Parameters, oscEngine),            ParameterType::FLOAT,   0.0f,     1.0f,    0.0f,    0.0f  },
+
+        { "sub_enabled",         offsetof(Parameters, subEnabled),           ParameterType::FLOAT,   0.0f,     1.0f,    1.0f,    0.0f  },
+        { "sub_level",           offsetof(Parameters, subLevel),             ParameterType::FLOAT,   0.0f,     1.0f,    0.4f,    0.02f },
+        { "noise_level",         offsetof(Parameters, noiseLevel),           ParameterType::FLOAT,   0.0f,     1.0f,    0.0f,    0.02f },
+
+        { "fm_enabled",          offsetof(Parameters, fmEnabled),            ParameterType::FLOAT,   0.0f,     1.0f,    0.0f,    0.0f  },
+        { "fm_carrier_osc",      offsetof(Parameters, fmCarrierOsc),         ParameterType::FLOAT,   0.0f,     1.0f,    0.0f,    0.0f  },
+        { "fm_mode",             offsetof(Parameters, fmMode),               ParameterType::FLOAT,   0.0f,     1.0f,    0.0f,    0.0f  },
+        { "fm_depth",            offsetof(Parameters, fmDepth),              ParameterType::FLOAT,   0.0f,     1.0f,    0.0f,    0.02f },
+        { "fm_modulator_ratio",  offsetof(Parameters, fmModulatorRatio),     ParameterType::FLOAT,   0.125f,   16.0f,   1.0f,    0.0f  },
+
+        { "filter_type",         offsetof(Parameters, filterType),           ParameterType::FLOAT,   0.0f,     3.0f,    0.0f,    0.0f  },
+        { "filter_cutoff",       offsetof(Parameters, filterCutoff),         ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+        { "filter_resonance",    offsetof(Parameters, filterResonance),      ParameterType::FLOAT,   0.0f,     1.0f,    0.7f,    0.02f },
+        { "filter_key_track",    offsetof(Parameters, filterKeyTrack),       ParameterType::FLOAT,  -1.0f,     1.0f,    0.0f,    0.0f  },
+        { "filter_vel_track",    offsetof(Parameters, filterVelTrack),       ParameterType::FLOAT,  -1.0f,     1.0f,    0.0f,    0.0f  },
+
+        { "filter_env_attack",   offsetof(Parameters, filterEnvAttack),      ParameterType::FLOAT,   0.0f,     30.0f,   0.01f,   0.0f  },
+        { "filter_env_decay",    offsetof(Parameters, filterEnvDecay),       ParameterType::FLOAT,   0.0f,     30.0f,   0.1f,    0.0f  },
+        { "filter_env_sustain",  offsetof(Parameters, filterEnvSustain),     ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.0f  },
+        { "filter_env_release",  offsetof(Parameters, filterEnvRelease),     ParameterType::FLOAT,   0.0f,     30.0f,   0.2f,    0.0f  },
+        { "filter_env_amount",   offsetof(Parameters, filterEnvAmount),      ParameterType::FLOAT,  -1.0f,     1.0f,    0.0f,    0.02f },
+
+        { "amp_env_attack",      offsetof(Parameters, ampEnvAttack),         ParameterType::FLOAT,   0.0f,     30.0f,   0.01f,   0.0f  },
+        { "amp_env_decay",       offsetof(Parameters, ampEnvDecay),          ParameterType::FLOAT,   0.0f,     30.0f,   0.3f,    0.0f  },
+        { "amp_env_sustain",     offsetof(Parameters, ampEnvSustain),        ParameterType::FLOAT,   0.0f,     1.0f,    0.7f,    0.0f  },
+        { "amp_env_release",     offsetof(Parameters, ampEnvRelease),        ParameterType::FLOAT,   0.0f,     30.0f,   0.4f,    0.0f  },
+
+        { "lfo1_waveform",       offsetof(Parameters, lfo1Waveform),         ParameterType::FLOAT,   0.0f,     4.0f,    0.0f,    0.0f  },
+        { "lfo1_rate",           offsetof(Parameters, lfo1Rate),             ParameterType::FLOAT,   0.01f,    50.0f,   5.0f,    0.02f },
+        { "lfo1_depth",          offsetof(Parameters, lfo1Depth),            ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+        { "lfo1_bipolar",        offsetof(Parameters, lfo1Bipolar),          ParameterType::FLOAT,   0.0f,     1.0f,    1.0f,    0.0f  },
+
+        { "lfo2_waveform",       offsetof(Parameters, lfo2Waveform),         ParameterType::FLOAT,   0.0f,     4.0f,    0.0f,    0.0f  },
+        { "lfo2_rate",           offsetof(Parameters, lfo2Rate),             ParameterType::FLOAT,   0.01f,    50.0f,   3.0f,    0.02f },
+        { "lfo2_depth",          offsetof(Parameters, lfo2Depth),            ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+        { "lfo2_bipolar",        offsetof(Parameters, lfo2Bipolar),          ParameterType::FLOAT,   0.0f,     1.0f,    1.0f,    0.0f  },
+
+        { "structure",           offsetof(Parameters, structure),            ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+        { "poly_mode",           offsetof(Parameters, polyMode),             ParameterType::FLOAT,   0.0f,     2.0f,    0.0f,    0.0f  },
+        { "glide_enabled",       offsetof(Parameters, glideEnabled),         ParameterType::FLOAT,   0.0f,     1.0f,    0.0f,    0.0f  },
+        { "glide_time",          offsetof(Parameters, glideTime),            ParameterType::FLOAT,   0.0f,     10.0f,   0.1f,    0.0f  },
+        { "master_tune",         offsetof(Parameters, masterTune),           ParameterType::FLOAT,  -24.0f,    24.0f,   0.0f,    0.0f  },
+        { "master_volume",       offsetof(Parameters, masterVolume),         ParameterType::FLOAT,   0.0f,     4.0f,    0.85f,   0.02f },
+        { "pitch_bend_range",    offsetof(Parameters, pitchBendRange),       ParameterType::DOUBLE,  0.0f,     48.0f,   2.0f,    0.0f  },
+
+        { "macro_0_value",       offsetof(Parameters, macroValue[0]),        ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+        { "macro_1_value",       offsetof(Parameters, macroValue[1]),        ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+        { "macro_2_value",       offsetof(Parameters, macroValue[2]),        ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+        { "macro_3_value",       offsetof(Parameters, macroValue[3]),        ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+        { "macro_4_value",       offsetof(Parameters, macroValue[4]),        ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+        { "macro_5_value",       offsetof(Parameters, macroValue[5]),        ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+        { "macro_6_value",       offsetof(Parameters, macroValue[6]),        ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+        { "macro_7_value",       offsetof(Parameters, macroValue[7]),        ParameterType::FLOAT,   0.0f,     1.0f,    0.5f,    0.02f },
+    };
+
+    static constexpr auto parameterRegistry = makeParameterRegistry<Parameters>(parameterDescriptors);
+    static_assert(parameterRegistry.isPerfect(), "parameter ids must be unique");
+
+    // Modulation matrix slots, "mod_<slot>_<source|destination|amount|bipolar|curve>":
+    // 16 slots x 5 fields, generated at compile time into a second registry
+    // (field-major: index = field * numModSlots + slot). The engine numbers
+    // them past the main table.
+    static constexpr int numModSlots = 16;
+    static constexpr int numModSlotFields = 5 * numModSlots;
+
+    struct ModSlotIds { char text[numModSlotFields][20]; };
+    struct ModSlotDescriptors { ParameterDescriptor table[numModSlotFields]; };
+
+    static constexpr ModSlotIds modSlotIds = []
+    {
+        const char* const fields[] = { "source", "destination", "amount", "bipolar", "curve" };
+        ModSlotIds ids {};
+        for (int f = 0; f < 5; ++f)
+        {
+            for (int slot = 0; slot < numModSlots; ++slot)
+            {
+                char* out = ids.text[f * numModSlots + slot];
+                int n = 0;
+                for (const char* c = "mod_"; *c != '\0'; ++c)
+                    out[n++] = *c;
+                if (slot >= 10)
+                    out[n++] = static_cast<char>('0' + slot / 10);
+                out[n++] = static_cast<char>('0' + slot % 10);
+                out[n++] = '_';
+                for (const char* c = fields[f]; *c != '\0'; ++c)
+                    out[n++] = *c;
+            }
+        }
+        return ids;
+    }();
+
+    static constexpr ModSlotDescriptors modSlotDescriptors = []
+    {
+        const std::size_t offsets[] = { offsetof(Parameters, modSource), offsetof(Parameters, modDestination),
+                                        offsetof(Parameters, modAmount), offsetof(Parameters, modBipolar),
+                                        offsetof(Parameters, modCurve) };
+        const float minValues[] = { 0.0f, 0.0f, -1.0f, 0.0f, 0.0f };
+        const float maxValues[] = { static_cast<float>(numModSources - 1), static_cast<float>(numModDestinations - 1), 1.0f, 1.0f, 1.0f };
+        const float defaultValues[] = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+
+        ModSlotDescriptors descriptors {};
+        for (int f = 0; f < 5; ++f)
+        {
+            for (int slot = 0; slot < numModSlots; ++slot)
+            {
+                const int i = f * numModSlots + slot;
+                descriptors.table[i] = { modSlotIds.text[i], offsets[f] + slot * sizeof(float), ParameterType::FLOAT,
+                                         minValues[f], maxValues[f], defaultValues[f], 0.0f };
+            }
+        }
+        return descriptors;
+    }();
+
+    static constexpr auto modSlotRegistry = makeParameterRegistry<Parameters>(modSlotDescriptors.table);
+    static_assert(modSlotRegistry.isPerfect(), "mod slot ids must be unique");
+
+    // params_ plus the macro offsets: what the voices and output stage read
+    Parameters modulatedParams_;
+
+    // Automation queued by scheduleParameterChange; process() moves it into
+    // pendingEvents_ (sorted by offset) and splits rendering at each one
+    static constexpr int maxParameterEvents = 1024;
+    ParameterEventQueue<maxParameterEvents> parameterEvents_;
+
+    // setParameter() and preset loads made off the audio thread; indices
+    // past the table address mod slot fields
+    ParameterEventQueue<maxParameterEvents> controlEvents_;
+    std::atomic<std::thread::id> audioThread_ {};   // of the last process(), unset before it
+    bool rebuildPending_ = false;
+    ParameterEvent pendingEvents_[maxParameterEvents];
+    ParameterEvent mergeScratch_[maxParameterEvents];
+    int numPendingEvents_ = 0;
+
+    // Linear automation ramps, stepped at the end of each control block
+    float rampTarget_[parameterRegistry.size] {};
+    float rampStep_[parameterRegistry.size] {};
+    int rampRemaining_[parameterRegistry.size] {};
+    int numActiveRamps_ = 0;
+    bool parameterSmoothing_ = true;
+
     double sampleRate_ = 48000.0;
     int blockSize_ = 512;
     double pitchBend_ = 0.0;
+    int controlRate_ = 32;
 
+    // Real-time safe temporary buffers (left, right); process() renders in
+    // sub-blocks of this size, so any host block size works
+    static constexpr int MAX_BLOCK_SIZE = 512;
+    alignas(32) float tempBuffer_[MAX_BLOCK_SIZE];
+    alignas(32) float tempBufferRight_[MAX_BLOCK_SIZE];
+
+    // Full rebuild: macro offsets, LFOs, mod matrix compile, every voice
     void applyParameters();
-    void processStereoSample(float& left, float& right);
+
+    // One table parameter moved: refresh its modulated value (a macro knob:
+    // the parameters it drives) and push only those to the voices
+    void applyParameterChange(int index);
+    void applyModulatedParameter(int index);
+    void applyLfoParameters();
+
+    // Table parameter or, past the table, mod slot field
+    void writeParameter(int index, float value);
+    bool onAudioThread() const;
+
+    // Writes a preset's values (or queues them, off the audio thread),
+    // dropping any ramps on the parameters it sets
+    bool applyPresetValues(const ParameterEvent* values, int numValues);
+
+    void drainParameterEvents();
+    void retireParameterEvents(int numApplied, int numSamples);
+    void startParameterChange(const ParameterEvent& event);
+    void advanceParameterRamps(int numSamples);   // steps the touched parameters only
+    void cancelParameterRamp(int index);
 
     float calculateFrequency(int midiNote, float bend = 0.0f) const;
 
@@ -0,0 +1,101 @@
+/*
+  ==============================================================================
+
+    ParameterEventQueue.h
+    Created: October 16, 2026
+
+    Lock-free single-producer/single-consumer queue for parameter automation
+    - The host/UI thread pushes (parameter index, value, sample offset)
+    - The audio thread pops in process(); no locks, no allocation
+    - Fixed power-of-two ring, head and tail on separate cache lines
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace DSP {
+
+// How a ParameterEvent lands
+enum class ParameterEventType : std::uint8_t
+{
+    Ramp,   // automation: ramps over the parameter's smoothing time
+    Set,    // a direct write made off the audio thread: jumps to the value
+    Load    // one value of a preset: jumps, applied with the rest of the preset
+};
+
+// A change to a parameter index, landing sampleOffset samples into the
+// process() call that picks it up
+struct ParameterEvent
+{
+    int index = -1;
+    float value = 0.0f;
+    int sampleOffset = 0;
+    ParameterEventType type = ParameterEventType::Ramp;
+};
+
+/**
+ * @brief Wait-free SPSC ring buffer
+ *
+ * Exactly one thread may push and exactly one (the audio thread) may pop.
+ * push() fails instead of blocking when the ring is full.
+ */
+template <typename T, int Capacity>
+class SPSCQueue
+{
+public:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+    // Producer side
+    bool push(const T& item)
+    {
+        const std::uint32_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == static_cast<std::uint32_t>(Capacity))
+            return false;
+
+        items_[tail & mask] = item;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& item)
+    {
+        const std::uint32_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire))
+            return false;
+
+        item = items_[head & mask];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: drops everything pushed so far
+    void clear()
+    {
+        head_.store(tail_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    // Approximate when called from the other thread
+    int size() const
+    {
+        return static_cast<int>(tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire));
+    }
+
+    static constexpr int capacity() { return Capacity; }
+
+private:
+    static constexpr std::uint32_t mask = static_cast<std::uint32_t>(Capacity - 1);
+
+    alignas(64) std::atomic<std::uint32_t> head_ { 0 };
+    alignas(64) std::atomic<std::uint32_t> tail_ { 0 };
+    alignas(64) T items_[Capacity] {};
+};
+
+template <int Capacity>
+using ParameterEventQueue = SPSCQueue<ParameterEvent, Capacity>;
+
+} // namespace DSP
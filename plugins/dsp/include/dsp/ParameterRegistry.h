@@ -0,0 +1,200 @@
+/*
+  ==============================================================================
+
+    ParameterRegistry.h
+    Created: October 16, 2026
+
+    Constexpr parameter descriptor tables shared by the pure DSP engines
+    - One descriptor per parameter: id, location in the engine's parameter
+      struct, range, default and automation smoothing time
+    - String ids resolve to table indices through a perfect hash found at
+      compile time: one hash, one table read, one string compare
+    - Index-based get/set clamp to the descriptor range; preset save/load
+      walks the same table, so ids are spelt exactly once per engine
+    - No allocation, no static initialisation (tvOS hardening)
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace DSP {
+
+enum class ParameterType : std::uint8_t { FLOAT, DOUBLE, INT };
+
+struct ParameterDescriptor
+{
+    const char* id;
+    std::size_t offset;           // offsetof() into the engine's parameter struct
+    ParameterType type;
+    float minValue;
+    float maxValue;
+    float defaultValue;
+    float smoothingSeconds;       // automation ramp; 0 = steps (switches, modes)
+};
+
+// FNV-1a with a seeded basis and a final avalanche, so every seed gives an
+// unrelated slot layout
+constexpr std::uint32_t hashParameterId(const char* id, std::uint32_t seed)
+{
+    std::uint32_t h = 2166136261u ^ (seed * 0x9e3779b9u);
+    for (; *id != '\0'; ++id)
+    {
+        h ^= static_cast<std::uint8_t>(*id);
+        h *= 16777619u;
+    }
+
+    h ^= h >> 16;
+    h *= 0x7feb352du;
+    h ^= h >> 15;
+    return h;
+}
+
+constexpr bool parameterIdsEqual(const char* a, const char* b)
+{
+    for (; *a != '\0' && *a == *b; ++a, ++b) {}
+    return *a == *b;
+}
+
+/**
+ * @brief Perfect-hash lookup over a constexpr descriptor table
+ *
+ * Built in a constant expression from the engine's table: the constructor
+ * tries seeds until every id lands in its own slot of a power-of-two slot
+ * table (8 slots per id keeps the search to a handful of seeds). Engines
+ * static_assert isPerfect(), so duplicate ids fail the build.
+ *
+ * @tparam Params The engine's parameter struct (standard layout)
+ * @tparam N      Number of descriptors
+ */
+template <typename Params, std::size_t N>
+class ParameterRegistry
+{
+public:
+    static constexpr int size = static_cast<int>(N);
+
+    constexpr explicit ParameterRegistry(const ParameterDescriptor (&table)[N])
+    {
+        static_assert(N < 128, "slot table stores int8_t indices");
+
+        for (std::size_t i = 0; i < N; ++i)
+            descriptors_[i] = table[i];
+
+        for (std::uint32_t seed = 0; seed < maxSeeds; ++seed)
+        {
+            if (tryPlace(seed))
+            {
+                seed_ = seed;
+                perfect_ = true;
+                return;
+            }
+        }
+    }
+
+    constexpr bool isPerfect() const { return perfect_; }
+
+    // Table index of an id, or -1 if the engine has no such parameter
+    constexpr int indexOf(const char* id) const
+    {
+        const int index = slots_[hashParameterId(id, seed_) & slotMask];
+        return (index >= 0 && parameterIdsEqual(descriptors_[static_cast<std::size_t>(index)].id, id)) ? index : -1;
+    }
+
+    constexpr const ParameterDescriptor& operator[](int index) const
+    {
+        return descriptors_[static_cast<std::size_t>(index)];
+    }
+
+    float get(const Params& params, int index) const
+    {
+        const auto& d = descriptors_[static_cast<std::size_t>(index)];
+        const auto* field = reinterpret_cast<const char*>(&params) + d.offset;
+
+        switch (d.type)
+        {
+            case ParameterType::DOUBLE:
+                return static_cast<float>(*reinterpret_cast<const double*>(field));
+
+            case ParameterType::INT:
+                return static_cast<float>(*reinterpret_cast<const int*>(field));
+
+            case ParameterType::FLOAT:
+            default:
+                return *reinterpret_cast<const float*>(field);
+        }
+    }
+
+    // Clamps to the descriptor range; returns the value actually stored
+    float set(Params& params, int index, float value) const
+    {
+        const auto& d = descriptors_[static_cast<std::size_t>(index)];
+        auto* field = reinterpret_cast<char*>(&params) + d.offset;
+
+        value = value < d.minValue ? d.minValue : (value > d.maxValue ? d.maxValue : value);
+
+        switch (d.type)
+        {
+            case ParameterType::DOUBLE:
+                *reinterpret_cast<double*>(field) = value;
+                return value;
+
+            case ParameterType::INT:
+                *reinterpret_cast<int*>(field) = static_cast<int>(value);
+                return static_cast<float>(static_cast<int>(value));
+
+            case ParameterType::FLOAT:
+            default:
+                *reinterpret_cast<float*>(field) = value;
+                return value;
+        }
+    }
+
+    void resetToDefaults(Params& params) const
+    {
+        for (int i = 0; i < size; ++i)
+            set(params, i, descriptors_[static_cast<std::size_t>(i)].defaultValue);
+    }
+
+private:
+    static constexpr std::size_t numSlots = [] {
+        std::size_t n = 1;
+        while (n < N * 8)
+            n <<= 1;
+        return n;
+    }();
+    static constexpr std::uint32_t slotMask = static_cast<std::uint32_t>(numSlots - 1);
+    static constexpr std::uint32_t maxSeeds = 4096;
+
+    constexpr bool tryPlace(std::uint32_t seed)
+    {
+        for (std::size_t s = 0; s < numSlots; ++s)
+            slots_[s] = -1;
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            const std::uint32_t slot = hashParameterId(descriptors_[i].id, seed) & slotMask;
+            if (slots_[slot] >= 0)
+                return false;
+            slots_[slot] = static_cast<std::int8_t>(i);
+        }
+
+        return true;
+    }
+
+    ParameterDescriptor descriptors_[N] {};
+    std::int8_t slots_[numSlots] {};
+    std::uint32_t seed_ = 0;
+    bool perfect_ = false;
+};
+
+template <typename Params, std::size_t N>
+constexpr ParameterRegistry<Params, N> makeParameterRegistry(const ParameterDescriptor (&table)[N])
+{
+    return ParameterRegistry<Params, N>(table);
+}
+
+} // namespace DSP
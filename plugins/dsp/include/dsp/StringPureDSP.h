@@ -20,6 +20,7 @@
 #pragma once
 
 #include "../../../../include/dsp/InstrumentDSP.h"
+#include "ParameterRegistry.h"
 #include <vector>
 #include <array>
 #include <memory>
@@ -301,6 +302,12 @@ public:
     int getActiveVoiceCount() const override;
     int getMaxPolyphony() const override { return 6; }
 
+    // Parameter table index of an id (-1 if unknown)
+    int getParameterIndex(const char* paramId) const { return parameterRegistry.indexOf(paramId); }
+    int getNumParameters() const { return parameterRegistry.size; }
+    float getParameterValue(int index) const;
+    void setParameterValue(int index, float value);
+
     const char* getInstrumentName() const override { return "MotionAetherString"; }
     const char* getInstrumentVersion() const override { return "1.0.0"; }
 
@@ -341,11 +348,29 @@ private:
         float pitchBendRange = 2.0f;
     } params_;
 
+    static constexpr ParameterDescriptor parameterDescriptors[] = {
+        // id                    offset                                      type                    min      max     default  smoothing
+        { "master_volume",       offsetof(Parameters, masterVolume),         ParameterType::FLOAT,   0.0f,    2.0f,   0.8f,    0.02f },
+        { "string_damping",      offsetof(Parameters, stringDamping),        ParameterType::FLOAT,   0.0f,    1.0f,   0.996f,  0.02f },
+        { "string_stiffness",    offsetof(Parameters, stringStiffness),      ParameterType::FLOAT,   0.0f,    1.0f,   0.0f,    0.02f },
+        { "string_brightness",   offsetof(Parameters, stringBrightness),     ParameterType::FLOAT,   0.0f,    1.0f,   0.5f,    0.02f },
+        { "bridge_coupling",     offsetof(Parameters, bridgeCoupling),       ParameterType::FLOAT,   0.0f,    1.0f,   0.3f,    0.02f },
+        { "body_resonance",      offsetof(Parameters, bodyResonance),        ParameterType::FLOAT,   0.0f,    2.0f,   1.0f,    0.02f },
+        { "attack_time",         offsetof(Parameters, attackTime),           ParameterType::FLOAT,   0.0f,    30.0f,  0.05f,   0.0f  },
+        { "decay_time",          offsetof(Parameters, decayTime),            ParameterType::FLOAT,   0.0f,    30.0f,  1.0f,    0.0f  },
+        { "sustain_level",       offsetof(Parameters, sustainLevel),         ParameterType::FLOAT,   0.0f,    1.0f,   0.7f,    0.0f  },
+        { "release_time",        offsetof(Parameters, releaseTime),          ParameterType::FLOAT,   0.0f,    30.0f,  2.0f,    0.0f  },
+    };
+
+    static constexpr auto parameterRegistry = makeParameterRegistry<Parameters>(parameterDescriptors);
+    static_assert(parameterRegistry.isPerfect(), "parameter ids must be unique");
+
     double sampleRate_ = 48000.0;
     int blockSize_ = 512;
     double pitchBend_ = 0.0;
 
     // Real-time safe temporary buffer for audio processing
+    // process() renders in sub-blocks of this size, so any host block size works
     static constexpr int MAX_BLOCK_SIZE = 512;
     alignas(32) float tempBuffer_[MAX_BLOCK_SIZE];
 
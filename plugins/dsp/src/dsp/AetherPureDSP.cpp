@@ -16,7 +16,6 @@
 #include <cstring>
 #include <random>
 #include <cmath>
-#include <cassert>
 #include <iostream>
 
 namespace DSP {
@@ -1150,6 +1149,7 @@ void AetherVoiceManager::processBlock(float* output, int numSamples, double samp
 {
     std::fill(output, output + numSamples, 0.0f);
     
+    // AetherPureDSP::process hands over at most MAX_BLOCK_SIZE (512) samples
     float temp[6][512];
     
     for (int v = 0; v < 6; ++v)
@@ -1443,17 +1443,21 @@ void AetherPureDSP::process(float** outputs, int numChannels, int numSamples)
     for (int ch = 0; ch < numChannels; ++ch)
         std::fill(outputs[ch], outputs[ch] + numSamples, 0.0f);
 
-    // Process voices (mono output) using real-time safe stack buffer
-    // Assert for safety in debug builds - block size should never exceed MAX_BLOCK_SIZE
-    assert(numSamples <= MAX_BLOCK_SIZE && "Block size exceeds maximum buffer size");
+    // Hosts may send any block size: render in sub-blocks that fit the
+    // real-time safe member buffer
+    for (int start = 0; start < numSamples; start += MAX_BLOCK_SIZE)
+    {
+        const int blockSamples = std::min(MAX_BLOCK_SIZE, numSamples - start);
 
-    voiceManager_.processBlock(tempBuffer_, numSamples, sampleRate_);
+        // Process voices (mono output)
+        voiceManager_.processBlock(tempBuffer_, blockSamples, sampleRate_);
 
-    // Copy to all channels
-    for (int ch = 0; ch < numChannels; ++ch)
-    {
-        for (int i = 0; i < numSamples; ++i)
-            outputs[ch][i] = tempBuffer_[i] * params_.masterVolume;
+        // Copy to all channels
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            for (int i = 0; i < blockSamples; ++i)
+                outputs[ch][start + i] = tempBuffer_[i] * params_.masterVolume;
+        }
     }
 }
 
@@ -1471,38 +1475,33 @@ void AetherPureDSP::handleEvent(const ScheduledEvent& event)
 
 float AetherPureDSP::getParameter(const char* paramId) const
 {
-    std::string id(paramId);
+    return getParameterValue(parameterRegistry.indexOf(paramId));
+}
 
-    if (id == "masterVolume") return static_cast<float>(params_.masterVolume);
-    if (id == "damping") return static_cast<float>(params_.damping);
-    if (id == "brightness") return static_cast<float>(params_.brightness);
-    if (id == "stiffness") return static_cast<float>(params_.stiffness);
-    if (id == "dispersion") return static_cast<float>(params_.dispersion);
-    if (id == "sympatheticCoupling") return static_cast<float>(params_.sympatheticCoupling);
-    if (id == "material") return static_cast<float>(params_.material);
-    if (id == "bodyPreset") return static_cast<float>(params_.bodyPreset);
+void AetherPureDSP::setParameter(const char* paramId, float value)
+{
+    setParameterValue(parameterRegistry.indexOf(paramId), value);
+}
 
-    return 0.0f;
+float AetherPureDSP::getParameterValue(int index) const
+{
+    if (index < 0 || index >= parameterRegistry.size)
+        return 0.0f;
+
+    return parameterRegistry.get(params_, index);
 }
 
-void AetherPureDSP::setParameter(const char* paramId, float value)
+void AetherPureDSP::setParameterValue(int index, float value)
 {
-    std::string id(paramId);
+    if (index < 0 || index >= parameterRegistry.size)
+        return;
 
     // Get old value for logging (before change)
-    float oldValue = getParameter(paramId);
-
-    if (id == "masterVolume") params_.masterVolume = value;
-    else if (id == "damping") params_.damping = value;
-    else if (id == "brightness") params_.brightness = value;
-    else if (id == "stiffness") params_.stiffness = value;
-    else if (id == "dispersion") params_.dispersion = value;
-    else if (id == "sympatheticCoupling") params_.sympatheticCoupling = value;
-    else if (id == "material") params_.material = value;
-    else if (id == "bodyPreset") params_.bodyPreset = static_cast<int>(value);
+    const float oldValue = parameterRegistry.get(params_, index);
+    parameterRegistry.set(params_, index, value);
 
     // Log parameter change (shared telemetry infrastructure)
-    LOG_PARAMETER_CHANGE("MotionAether", paramId, oldValue, value);
+    LOG_PARAMETER_CHANGE("MotionAether", parameterRegistry[index].id, oldValue, value);
 
     applyParameters();
 }
@@ -1517,10 +1516,11 @@ bool AetherPureDSP::savePreset(char* jsonBuffer, int jsonBufferSize) const
         return false;
     offset += written;
 
-    writeJsonParameter("masterVolume", params_.masterVolume, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("damping", params_.damping, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("brightness", params_.brightness, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("stiffness", params_.stiffness, jsonBuffer, offset, jsonBufferSize);
+    for (int i = 0; i < parameterRegistry.size; ++i)
+    {
+        if (!writeJsonParameter(parameterRegistry[i].id, parameterRegistry.get(params_, i), jsonBuffer, offset, jsonBufferSize))
+            return false;
+    }
 
     // Remove trailing comma and add closing brace
     if (offset > 1 && jsonBuffer[offset - 1] == ',')
@@ -1634,35 +1634,11 @@ bool AetherPureDSP::loadUPFSPreset(const char* jsonData)
         params_.damping = std::max(0.9, params_.damping * (1.0 - (value * 0.01)));
 
     // Direct parameter mappings (these override the calculated values)
-    if (parseJsonParameter(jsonData, "masterVolume", value))
-        params_.masterVolume = value;
-
-    if (parseJsonParameter(jsonData, "damping", value))
-        params_.damping = value;
-
-    if (parseJsonParameter(jsonData, "brightness", value))
-        params_.brightness = value;
-
-    if (parseJsonParameter(jsonData, "stiffness", value))
-        params_.stiffness = value;
-
-    if (parseJsonParameter(jsonData, "dispersion", value))
-        params_.dispersion = value;
-
-    if (parseJsonParameter(jsonData, "sympatheticCoupling", value))
-        params_.sympatheticCoupling = value;
-
-    if (parseJsonParameter(jsonData, "material", value))
-        params_.material = value;
-
-    if (parseJsonParameter(jsonData, "bodyPreset", value))
-        params_.bodyPreset = static_cast<int>(value);
-
-    if (parseJsonParameter(jsonData, "bridgeCoupling", value))
-        params_.bridgeCoupling = value;
-
-    if (parseJsonParameter(jsonData, "nonlinearity", value))
-        params_.nonlinearity = value;
+    for (int i = 0; i < parameterRegistry.size; ++i)
+    {
+        if (parseJsonParameter(jsonData, parameterRegistry[i].id, value))
+            parameterRegistry.set(params_, i, static_cast<float>(value));
+    }
 
     applyParameters();
     return true;
@@ -1778,37 +1754,12 @@ bool AetherPureDSP::loadPreset(const char* jsonData)
     params_.nonlinearity = baseNonlinearity;
 
     // Direct parameter mappings (names match) - these override the calculated values
-    if (parseJsonParameter(jsonData, "masterVolume", value)) {
-        params_.masterVolume = value;
-        paramsFound++;
-    }
-    if (parseJsonParameter(jsonData, "damping", value)) {
-        params_.damping = value;
-        paramsFound++;
-    }
-    if (parseJsonParameter(jsonData, "brightness", value)) {
-        params_.brightness = value;
-        paramsFound++;
-    }
-    if (parseJsonParameter(jsonData, "stiffness", value)) {
-        params_.stiffness = value;
-        paramsFound++;
-    }
-    if (parseJsonParameter(jsonData, "dispersion", value)) {
-        params_.dispersion = value;
-        paramsFound++;
-    }
-    if (parseJsonParameter(jsonData, "sympatheticCoupling", value)) {
-        params_.sympatheticCoupling = value;
-        paramsFound++;
-    }
-    if (parseJsonParameter(jsonData, "material", value)) {
-        params_.material = value;
-        paramsFound++;
-    }
-    if (parseJsonParameter(jsonData, "bodyPreset", value)) {
-        params_.bodyPreset = static_cast<int>(value);
-        paramsFound++;
+    for (int i = 0; i < parameterRegistry.size; ++i)
+    {
+        if (parseJsonParameter(jsonData, parameterRegistry[i].id, value)) {
+            parameterRegistry.set(params_, i, static_cast<float>(value));
+            paramsFound++;
+        }
     }
 
     applyParameters();
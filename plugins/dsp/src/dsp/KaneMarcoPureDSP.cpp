@@ -15,10 +15,14 @@
 #include "dsp/MotionPureDSP.h"
 #include "../../../../include/dsp/LookupTables.h"
 #include "../../../../include/dsp/DSPLogging.h"
+#include "../../../../include/dsp/FastMath.h"
 #include "../../../../../libraries/upfs/PresetParser.h"
 #include <cstring>
+#include <cstdlib>
 #include <cstdio>
 #include <cmath>
+#include <complex>
+#include <limits>
 
 namespace DSP {
 
@@ -51,6 +55,160 @@ static inline double clamp(double x, double min, double max)
     return (x < min) ? min : (x > max) ? max : x;
 }
 
+//==============================================================================
+// WAVETABLE BANK IMPLEMENTATION
+//==============================================================================
+
+namespace
+{
+    // In-place radix-2 FFT (size a power of two); inverse is unscaled
+    void wavetableFFT(std::vector<std::complex<double>>& data, bool inverse)
+    {
+        const size_t n = data.size();
+
+        for (size_t i = 1, j = 0; i < n; ++i)
+        {
+            size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1)
+                j ^= bit;
+            j ^= bit;
+
+            if (i < j)
+                std::swap(data[i], data[j]);
+        }
+
+        for (size_t len = 2; len <= n; len <<= 1)
+        {
+            const double angle = (inverse ? 2.0 : -2.0) * M_PI / static_cast<double>(len);
+            const std::complex<double> step(std::cos(angle), std::sin(angle));
+
+            for (size_t start = 0; start < n; start += len)
+            {
+                std::complex<double> w(1.0, 0.0);
+                for (size_t k = 0; k < len / 2; ++k)
+                {
+                    const auto even = data[start + k];
+                    const auto odd = data[start + k + len / 2] * w;
+                    data[start + k] = even + odd;
+                    data[start + k + len / 2] = even - odd;
+                    w *= step;
+                }
+            }
+        }
+    }
+
+    // The PolyBLEP engine's naive shapes, phase in [0, 1)
+    double naiveWaveform(Waveform shape, double p)
+    {
+        switch (shape)
+        {
+            case Waveform::SAW:      return 2.0 * p - 1.0;
+            case Waveform::SQUARE:   return (p < 0.5) ? 1.0 : -1.0;
+            case Waveform::TRIANGLE: return 2.0 * std::abs(2.0 * p - 1.0) - 1.0;
+            case Waveform::SINE:     return std::sin(2.0 * M_PI * p);
+            default:                 return 0.0;
+        }
+    }
+
+    int clampLevel(int level)
+    {
+        return std::max(0, std::min(WavetableBank::numLevels - 1, level));
+    }
+}
+
+const WavetableBank& WavetableBank::getInstance()
+{
+    static const WavetableBank bank;
+    return bank;
+}
+
+WavetableBank::WavetableBank()
+{
+    constexpr int stride = tableSize + 1;
+
+    // The warped cycle is sampled well above the highest kept harmonic, so
+    // the spectrum it yields is accurate for the 1024 harmonics used
+    constexpr int analysisSize = tableSize * 8;
+
+    tables_.assign(static_cast<size_t>(numShapes * numWarpSets * numLevels * stride), 0.0f);
+
+    std::vector<std::complex<double>> spectrum(analysisSize);
+    std::vector<std::complex<double>> table(tableSize);
+
+    for (int shape = 0; shape < numShapes; ++shape)
+    {
+        for (int warpSet = 0; warpSet < numWarpSets; ++warpSet)
+        {
+            // Oscillator::processSample warp: p + warp * sin(2 pi p)
+            const double warp = -1.0 + 2.0 * warpSet / (numWarpSets - 1);
+
+            for (int n = 0; n < analysisSize; ++n)
+            {
+                const double p = static_cast<double>(n) / analysisSize;
+                double warped = p + warp * std::sin(2.0 * M_PI * p);
+                warped -= std::floor(warped);
+                spectrum[static_cast<size_t>(n)] = naiveWaveform(static_cast<Waveform>(shape), warped);
+            }
+
+            wavetableFFT(spectrum, false);
+
+            for (int level = 0; level < numLevels; ++level)
+            {
+                const int harmonics = std::min(tableSize / 2 - 1, (tableSize / 2) >> level);
+
+                std::fill(table.begin(), table.end(), std::complex<double>());
+                table[0] = spectrum[0] / static_cast<double>(analysisSize);
+                for (int k = 1; k <= harmonics; ++k)
+                {
+                    const auto bin = spectrum[static_cast<size_t>(k)] / static_cast<double>(analysisSize);
+                    table[static_cast<size_t>(k)] = bin;
+                    table[static_cast<size_t>(tableSize - k)] = std::conj(bin);
+                }
+
+                wavetableFFT(table, true);
+
+                float* out = &tables_[static_cast<size_t>(((shape * numWarpSets + warpSet) * numLevels + level) * stride)];
+                for (int n = 0; n < tableSize; ++n)
+                    out[n] = static_cast<float>(table[static_cast<size_t>(n)].real());
+                out[tableSize] = out[0];
+            }
+        }
+    }
+}
+
+const float* WavetableBank::getTable(Waveform shape, int warpSet, int level) const
+{
+    const int s = std::max(0, std::min(numShapes - 1, static_cast<int>(shape)));
+    return &tables_[static_cast<size_t>(((s * numWarpSets + warpSet) * numLevels + level) * (tableSize + 1))];
+}
+
+WavetableBank::Selection WavetableBank::select(Waveform shape, float warp, double phaseIncrement) const
+{
+    // Warp: crossfade the two neighbouring baked sets
+    const float warpPos = (std::max(-1.0f, std::min(1.0f, warp)) + 1.0f) * 0.5f * (numWarpSets - 1);
+    const int warpLo = std::min(static_cast<int>(warpPos), numWarpSets - 2);
+    const float warpFrac = warpPos - static_cast<float>(warpLo);
+
+    // Pitch: level ceil(x) is the first without aliasing at this increment;
+    // fading toward the next one over the octave avoids a step at each edge
+    const double x = std::log2(std::max(phaseIncrement, 1.0e-9) * tableSize);
+    const int level = static_cast<int>(std::ceil(x));
+    const int levelLo = clampLevel(level);
+    const int levelHi = clampLevel(level + 1);
+    const float levelFrac = (level < 0) ? 0.0f : static_cast<float>(std::min(1.0, x - level + 1.0));
+
+    Selection selection;
+    selection.tables[0] = getTable(shape, warpLo, levelLo);
+    selection.tables[1] = getTable(shape, warpLo, levelHi);
+    selection.tables[2] = getTable(shape, warpLo + 1, levelLo);
+    selection.tables[3] = getTable(shape, warpLo + 1, levelHi);
+    selection.weights[0] = (1.0f - warpFrac) * (1.0f - levelFrac);
+    selection.weights[1] = (1.0f - warpFrac) * levelFrac;
+    selection.weights[2] = warpFrac * (1.0f - levelFrac);
+    selection.weights[3] = warpFrac * levelFrac;
+    return selection;
+}
+
 //==============================================================================
 // OSCILLATOR IMPLEMENTATION
 //==============================================================================
@@ -67,28 +225,81 @@ void Oscillator::prepare(double sampleRate)
 
 void Oscillator::reset()
 {
-    phase = 0.0;
-    phaseIncrement = 0.0;
+    phase = 0.0f;
+    phaseIncrement = 0.0f;
     warp = 0.0f;
     pulseWidth = 0.5f;
     waveform = Waveform::SAW;
     isFMCcarrier = false;
     fmDepth = 0.0f;
+    // engine is a synth parameter, like the sub oscillator's enable
+    updateWavetableSelection();
 }
 
 void Oscillator::setFrequency(float freqHz, double sampleRate)
 {
-    phaseIncrement = freqHz / sampleRate;
+    phaseIncrement = static_cast<float>(freqHz / sampleRate);
+    updateWavetableSelection();
 }
 
 void Oscillator::setWarp(float warpAmount)
 {
     warp = std::max(-1.0f, std::min(1.0f, warpAmount));
+    updateWavetableSelection();
 }
 
 void Oscillator::setWaveform(int waveformIndex)
 {
     waveform = static_cast<Waveform>(std::max(0, std::min(4, waveformIndex)));
+    updateWavetableSelection();
+}
+
+void Oscillator::setEngine(OscillatorEngine newEngine)
+{
+    engine = newEngine;
+    updateWavetableSelection();
+}
+
+void Oscillator::updateWavetableSelection()
+{
+    if (engine != OscillatorEngine::WAVETABLE)
+        return;
+
+    // PULSE is two reads of the unwarped SAW set; its warp is applied per sample
+    const auto& bank = WavetableBank::getInstance();
+    wavetable_ = (waveform == Waveform::PULSE) ? bank.select(Waveform::SAW, 0.0f, phaseIncrement)
+                                               : bank.select(waveform, warp, phaseIncrement);
+}
+
+float Oscillator::renderWavetable(double p) const
+{
+    auto read = [this](double q)
+    {
+        const double pos = q * WavetableBank::tableSize;
+        const int index = std::min(static_cast<int>(pos), WavetableBank::tableSize - 1);
+        const float frac = static_cast<float>(pos - index);
+
+        float sum = 0.0f;
+        for (int t = 0; t < 4; ++t)
+        {
+            const float* table = wavetable_.tables[t];
+            sum += wavetable_.weights[t] * (table[index] + frac * (table[index + 1] - table[index]));
+        }
+        return sum;
+    };
+
+    p -= std::floor(p);
+
+    if (waveform != Waveform::PULSE)
+        return read(p);
+
+    // Band-limited pulse as the difference of two saws a pulse width apart
+    double warped = p + (warp * SchillingerEcosystem::DSP::fastSineLookup(static_cast<float>(p * 2.0 * M_PI)));
+    warped -= std::floor(warped);
+    double shifted = warped - pulseWidth;
+    shifted -= std::floor(shifted);
+
+    return read(shifted) - read(warped) + (2.0f * pulseWidth - 1.0f);
 }
 
 void Oscillator::setPulseWidth(float pw)
@@ -108,6 +319,18 @@ void Oscillator::setIsFMCarrier(bool isCarrier)
 
 float Oscillator::processSample()
 {
+    if (engine == OscillatorEngine::WAVETABLE)
+    {
+        // Warp is baked into the tables
+        float output = renderWavetable(phase);
+
+        phase += phaseIncrement;
+        if (phase >= 1.0f)
+            phase -= 1.0f;
+
+        return output;
+    }
+
     // Apply phase warp: phase_warped = phase + (warp * sin(2π * phase))
     // Use LookupTables for sine calculation
     double warpedPhase = phase + (warp * SchillingerEcosystem::DSP::fastSineLookup(static_cast<float>(phase * 2.0 * M_PI)));
@@ -117,8 +340,8 @@ float Oscillator::processSample()
 
     // Advance phase
     phase += phaseIncrement;
-    if (phase >= 1.0)
-        phase -= 1.0;
+    if (phase >= 1.0f)
+        phase -= 1.0f;
 
     return output;
 }
@@ -128,6 +351,17 @@ float Oscillator::processSampleWithFM(float modulationInput)
     // Phase modulation from FM input
     double modulatedPhase = phase + (fmDepth * modulationInput);
 
+    if (engine == OscillatorEngine::WAVETABLE)
+    {
+        float output = renderWavetable(modulatedPhase);
+
+        phase += phaseIncrement;
+        if (phase >= 1.0f)
+            phase -= 1.0f;
+
+        return output;
+    }
+
     // Apply warp using LookupTables for sine calculation
     double warpedPhase = modulatedPhase + (warp * SchillingerEcosystem::DSP::fastSineLookup(static_cast<float>(modulatedPhase * 2.0 * M_PI)));
 
@@ -136,8 +370,8 @@ float Oscillator::processSampleWithFM(float modulationInput)
 
     // Advance phase
     phase += phaseIncrement;
-    if (phase >= 1.0)
-        phase -= 1.0;
+    if (phase >= 1.0f)
+        phase -= 1.0f;
 
     return output;
 }
@@ -213,12 +447,307 @@ float Oscillator::polyBlepPulse(double p, double pw) const
     return naive + blep1 - blep2;
 }
 
+//==============================================================================
+// UNISON OSCILLATOR IMPLEMENTATION
+//==============================================================================
+
+namespace
+{
+    constexpr int kCopyBlock = UnisonOscillator::copyBlock;
+
+    // Oscillator::polyBlep in float with selects, as the lane renderer's
+    inline float unisonPolyBlep(float t, float dt, float invDt)
+    {
+        const float a = t * invDt;
+        const float b = (t - 1.0f) * invDt;
+        return (t < dt) ? (a + a - a * a - 1.0f)
+             : (t > 1.0f - dt) ? (b + b + b * b + 1.0f)
+             : 0.0f;
+    }
+
+    inline float unisonWrap(float p)
+    {
+        return p - std::floor(p);
+    }
+
+    // One block of copies through Oscillator::generateWaveform
+    void unisonKernel(Waveform waveform, float warp, float pulseWidth, const float* phase,
+                      const float* inc, const float* invInc, float phaseOffset, float* out)
+    {
+        namespace FastMath = SchillingerEcosystem::DSP::FastMath;
+
+        alignas(32) float p[kCopyBlock];
+        for (int k = 0; k < kCopyBlock; ++k)
+            p[k] = unisonWrap(phase[k] + phaseOffset);
+
+        if (warp != 0.0f)
+            for (int k = 0; k < kCopyBlock; ++k)
+                p[k] = unisonWrap(p[k] + warp * FastMath::sin2Pi(p[k]));
+
+        switch (waveform)
+        {
+            case Waveform::SAW:
+                for (int k = 0; k < kCopyBlock; ++k)
+                    out[k] = 2.0f * p[k] - 1.0f - unisonPolyBlep(p[k], inc[k], invInc[k]);
+                break;
+
+            case Waveform::SQUARE:
+                for (int k = 0; k < kCopyBlock; ++k)
+                {
+                    const float naive = (p[k] < 0.5f) ? 1.0f : -1.0f;
+                    out[k] = naive + unisonPolyBlep(p[k], inc[k], invInc[k])
+                                   - unisonPolyBlep(unisonWrap(p[k] + 0.5f), inc[k], invInc[k]);
+                }
+                break;
+
+            case Waveform::TRIANGLE:
+                for (int k = 0; k < kCopyBlock; ++k)
+                    out[k] = 2.0f * std::abs(2.0f * p[k] - 1.0f) - 1.0f;
+                break;
+
+            case Waveform::SINE:
+                for (int k = 0; k < kCopyBlock; ++k)
+                    out[k] = FastMath::sin2Pi(p[k]);
+                break;
+
+            case Waveform::PULSE:
+                for (int k = 0; k < kCopyBlock; ++k)
+                {
+                    const float naive = (p[k] < pulseWidth) ? 1.0f : -1.0f;
+                    out[k] = naive + unisonPolyBlep(p[k], inc[k], invInc[k])
+                                   - unisonPolyBlep(unisonWrap(p[k] + (1.0f - pulseWidth)), inc[k], invInc[k]);
+                }
+                break;
+        }
+    }
+
+    // Oscillator::renderWavetable's interpolated read, one block of phases in [0, 1)
+    void unisonTableRead(const WavetableBank::Selection& tables, const float* p, float* out)
+    {
+        constexpr int tableSize = WavetableBank::tableSize;
+
+        for (int k = 0; k < kCopyBlock; ++k)
+        {
+            const float pos = p[k] * static_cast<float>(tableSize);
+            const int index = std::min(static_cast<int>(pos), tableSize - 1);
+            const float frac = pos - static_cast<float>(index);
+
+            float sum = 0.0f;
+            for (int t = 0; t < 4; ++t)
+            {
+                const float* table = tables.tables[t];
+                sum += tables.weights[t] * (table[index] + frac * (table[index + 1] - table[index]));
+            }
+            out[k] = sum;
+        }
+    }
+
+    // One block of copies through Oscillator::renderWavetable
+    void unisonWavetableKernel(const WavetableBank::Selection& tables, Waveform waveform, float warp, float pulseWidth,
+                               const float* phase, float phaseOffset, float* out)
+    {
+        namespace FastMath = SchillingerEcosystem::DSP::FastMath;
+
+        alignas(32) float p[kCopyBlock];
+        for (int k = 0; k < kCopyBlock; ++k)
+            p[k] = unisonWrap(phase[k] + phaseOffset);
+
+        if (waveform != Waveform::PULSE)
+        {
+            unisonTableRead(tables, p, out);
+            return;
+        }
+
+        // Band-limited pulse as the difference of two saws a pulse width apart
+        if (warp != 0.0f)
+            for (int k = 0; k < kCopyBlock; ++k)
+                p[k] = unisonWrap(p[k] + warp * FastMath::sin2Pi(p[k]));
+
+        alignas(32) float shifted[kCopyBlock];
+        alignas(32) float warped[kCopyBlock];
+        for (int k = 0; k < kCopyBlock; ++k)
+            shifted[k] = unisonWrap(p[k] - pulseWidth);
+
+        unisonTableRead(tables, shifted, out);
+        unisonTableRead(tables, p, warped);
+        for (int k = 0; k < kCopyBlock; ++k)
+            out[k] += (2.0f * pulseWidth - 1.0f) - warped[k];
+    }
+}
+
+UnisonOscillator::UnisonOscillator()
+{
+    reset();
+    setVoices(1, 0.0f);
+}
+
+void UnisonOscillator::reset()
+{
+    // golden-ratio start phases: the copies never begin in step
+    for (int k = 0; k < maxVoices; ++k)
+    {
+        const double p = k * 0.6180339887498949;
+        phase_[k] = static_cast<float>(p - std::floor(p));
+    }
+}
+
+void UnisonOscillator::setVoices(int numVoices, float detune, float spread)
+{
+    numVoices = std::max(1, std::min(maxVoices, numVoices));
+    detune = std::max(0.0f, std::min(1.0f, detune));
+    spread = std::max(0.0f, std::min(1.0f, spread));
+
+    if (numVoices == numVoices_ && detune == detune_ && spread == spread_ && numBlocks_ > 0)
+        return;
+
+    numVoices_ = numVoices;
+    detune_ = detune;
+    spread_ = spread;
+    numBlocks_ = (numVoices + copyBlock - 1) / copyBlock;
+
+    // copies evenly spaced across +-detune * maxDetuneCents and panned to
+    // +-spread by the same position; padding copies in the last block are
+    // silent and stand still
+    const float level = 1.0f / std::sqrt(static_cast<float>(numVoices));
+    for (int k = 0; k < maxVoices; ++k)
+    {
+        if (k < numVoices)
+        {
+            const float position = (numVoices > 1) ? 2.0f * k / (numVoices - 1) - 1.0f : 0.0f;
+            ratio_[k] = std::exp2(position * detune * maxDetuneCents / 1200.0f);
+            gain_[k] = level;
+
+            // constant power, sqrt(2) so a centred copy has gain 1 per side
+            const float angle = (position * spread + 1.0f) * 0.25f * static_cast<float>(M_PI);
+            gainLeft_[k] = level * static_cast<float>(M_SQRT2) * std::cos(angle);
+            gainRight_[k] = level * static_cast<float>(M_SQRT2) * std::sin(angle);
+        }
+        else
+        {
+            ratio_[k] = 0.0f;
+            gain_[k] = 0.0f;
+            gainLeft_[k] = 0.0f;
+            gainRight_[k] = 0.0f;
+        }
+    }
+
+    updateIncrements(centreIncrement_);
+}
+
+void UnisonOscillator::updateIncrements(float centreIncrement)
+{
+    centreIncrement_ = centreIncrement;
+
+    for (int k = 0; k < maxVoices; ++k)
+    {
+        increment_[k] = centreIncrement * ratio_[k];
+        invIncrement_[k] = (increment_[k] > 0.0f) ? 1.0f / increment_[k] : 0.0f;
+    }
+
+    tablesValid_ = false;
+}
+
+void UnisonOscillator::updateTables(Waveform shape, float warp)
+{
+    // PULSE is two reads of the unwarped SAW set, as in Oscillator
+    const auto& bank = WavetableBank::getInstance();
+    for (int b = 0; b < numBlocks_; ++b)
+    {
+        const float* increments = increment_ + b * copyBlock;
+        const float highest = *std::max_element(increments, increments + copyBlock);
+        blockTables_[b] = (shape == Waveform::PULSE) ? bank.select(Waveform::SAW, 0.0f, highest)
+                                                     : bank.select(shape, warp, highest);
+    }
+
+    tableShape_ = shape;
+    tableWarp_ = warp;
+    tablesValid_ = true;
+}
+
+void UnisonOscillator::renderCopies(const Oscillator& osc, float phaseOffset, float* out)
+{
+    // pitch moves between blocks (note-on, legato, the modulation matrix)
+    if (osc.phaseIncrement != centreIncrement_)
+        updateIncrements(osc.phaseIncrement);
+
+    const int numCopies = numBlocks_ * copyBlock;
+
+    if (osc.engine == OscillatorEngine::WAVETABLE)
+    {
+        if (!tablesValid_ || osc.waveform != tableShape_ || osc.warp != tableWarp_)
+            updateTables(osc.waveform, osc.warp);
+
+        for (int b = 0; b < numCopies; b += copyBlock)
+            unisonWavetableKernel(blockTables_[b / copyBlock], osc.waveform, osc.warp, osc.pulseWidth,
+                                  phase_ + b, phaseOffset, out + b);
+    }
+    else
+    {
+        for (int b = 0; b < numCopies; b += copyBlock)
+            unisonKernel(osc.waveform, osc.warp, osc.pulseWidth, phase_ + b, increment_ + b, invIncrement_ + b,
+                         phaseOffset, out + b);
+    }
+}
+
+float UnisonOscillator::processSample(const Oscillator& osc, float phaseOffset)
+{
+    alignas(32) float out[maxVoices];
+    renderCopies(osc, phaseOffset, out);
+
+    // per-lane partial sums keep the reduction in vector registers
+    alignas(32) float sum[copyBlock] {};
+    for (int b = 0; b < numBlocks_ * copyBlock; b += copyBlock)
+    {
+        for (int k = 0; k < copyBlock; ++k)
+        {
+            sum[k] += out[b + k] * gain_[b + k];
+
+            const float p = phase_[b + k] + increment_[b + k];
+            phase_[b + k] = (p >= 1.0f) ? p - 1.0f : p;
+        }
+    }
+
+    float total = 0.0f;
+    for (int k = 0; k < copyBlock; ++k)
+        total += sum[k];
+
+    return total;
+}
+
+void UnisonOscillator::processStereoSample(const Oscillator& osc, float phaseOffset, float& left, float& right)
+{
+    alignas(32) float out[maxVoices];
+    renderCopies(osc, phaseOffset, out);
+
+    alignas(32) float sumLeft[copyBlock] {};
+    alignas(32) float sumRight[copyBlock] {};
+    for (int b = 0; b < numBlocks_ * copyBlock; b += copyBlock)
+    {
+        for (int k = 0; k < copyBlock; ++k)
+        {
+            sumLeft[k] += out[b + k] * gainLeft_[b + k];
+            sumRight[k] += out[b + k] * gainRight_[b + k];
+
+            const float p = phase_[b + k] + increment_[b + k];
+            phase_[b + k] = (p >= 1.0f) ? p - 1.0f : p;
+        }
+    }
+
+    left = 0.0f;
+    right = 0.0f;
+    for (int k = 0; k < copyBlock; ++k)
+    {
+        left += sumLeft[k];
+        right += sumRight[k];
+    }
+}
+
 //==============================================================================
 // SUB-OSCILLATOR IMPLEMENTATION
 //==============================================================================
 
 SubOscillator::SubOscillator()
-    : phaseIncrement(0.0)
+    : phaseIncrement(0.0f)
 {
     reset();
 }
@@ -230,7 +759,7 @@ void SubOscillator::prepare(double sampleRate)
 
 void SubOscillator::reset()
 {
-    phase = 0.0;
+    phase = 0.0f;
     // Don't reset enabled or level - they are controlled by synth parameters
     // enabled = true;
     // level = 0.5f;
@@ -240,7 +769,7 @@ void SubOscillator::reset()
 void SubOscillator::setFrequency(float baseFreq, double sampleRate)
 {
     // Sub-oscillator is always -1 octave
-    phaseIncrement = (baseFreq * 0.5) / sampleRate;
+    phaseIncrement = static_cast<float>((baseFreq * 0.5) / sampleRate);
 }
 
 float SubOscillator::processSample()
@@ -249,12 +778,12 @@ float SubOscillator::processSample()
         return 0.0f;
 
     // Square wave at -1 octave
-    float output = (phase < 0.5) ? 1.0f : -1.0f;
+    float output = (phase < 0.5f) ? 1.0f : -1.0f;
 
     // Advance phase
     phase += phaseIncrement;
-    if (phase >= 1.0)
-        phase -= 1.0;
+    if (phase >= 1.0f)
+        phase -= 1.0f;
 
     return output * level;
 }
@@ -290,8 +819,8 @@ float NoiseGenerator::nextFloat()
 //==============================================================================
 
 SVFFilter::SVFFilter()
-    : v0(0.0f), v1(0.0f), v2(0.0f), v3(0.0f)
 {
+    updateCoefficients();
 }
 
 void SVFFilter::prepare(double sampleRate)
@@ -302,13 +831,15 @@ void SVFFilter::prepare(double sampleRate)
 
 void SVFFilter::reset()
 {
-    v0 = 0.0f;
-    v1 = 0.0f;
-    v2 = 0.0f;
-    v3 = 0.0f;
+    ic1eq = 0.0f;
+    ic2eq = 0.0f;
+    ic1eqRight = 0.0f;
+    ic2eqRight = 0.0f;
     type = FilterType::LOWPASS;
     cutoff = 1000.0f;
     resonance = 0.5f;
+    modulationOctaves = 0.0f;
+    updateCoefficients();
 }
 
 void SVFFilter::setType(FilterType t)
@@ -318,58 +849,113 @@ void SVFFilter::setType(FilterType t)
 
 void SVFFilter::setCutoff(float freqHz)
 {
-    cutoff = std::max(20.0f, std::min(20000.0f, freqHz));
+    const float newCutoff = std::max(20.0f, std::min(20000.0f, freqHz));
+    if (newCutoff != cutoff)
+    {
+        cutoff = newCutoff;
+        updateCoefficients();
+    }
 }
 
 void SVFFilter::setResonance(float res)
 {
-    resonance = std::max(0.0f, std::min(1.0f, res));
+    const float newResonance = std::max(0.0f, std::min(1.0f, res));
+    if (newResonance != resonance)
+    {
+        resonance = newResonance;
+        updateCoefficients();
+    }
 }
 
-float SVFFilter::processSample(float input)
+void SVFFilter::setModulation(float octaves, int numSamples)
+{
+    modulationOctaves = octaves;
+    const float target = frequencyCoefficient(octaves);
+
+    if (target == g || numSamples <= 1)
+    {
+        updateCoefficients();
+        return;
+    }
+
+    gTarget = target;
+    gRatio = std::pow(target / g, 1.0f / static_cast<float>(numSamples));
+    rampSamples = numSamples;
+}
+
+float SVFFilter::frequencyCoefficient(float octaves) const
 {
-    // State Variable Filter (Zölzer style)
-    // Based on "Designing Audio Effect Plugins in C++" by Will Pirkle
+    // kept just below Nyquist, where tan() runs off
+    const float nyquistLimit = 0.49f * static_cast<float>(sampleRate_);
+    const float fc = std::max(20.0f, std::min(nyquistLimit, cutoff * std::exp2(octaves)));
+    return std::tan(static_cast<float>(M_PI) * fc / static_cast<float>(sampleRate_));
+}
 
-    float fc = cutoff / static_cast<float>(sampleRate_);
-    if (fc > 0.5f) fc = 0.5f;
+void SVFFilter::updateCoefficients()
+{
+    // resonance 0 is Q = 0.5 (no peak); 1 is close to self-oscillation
+    k = std::max(2.0f * (1.0f - resonance), 0.01f);
+    g = gTarget = frequencyCoefficient(modulationOctaves);
+    gRatio = 1.0f;
+    rampSamples = 0;
+    updateGains();
+}
 
-    float fs = fc;  // Normalized frequency
+void SVFFilter::updateGains()
+{
+    a1 = 1.0f / (1.0f + g * (g + k));
+    a2 = g * a1;
+    a3 = g * a2;
+}
 
-    // Damping factor (resonance)
-    float q = 1.0f - resonance;
-    if (q < 0.001f) q = 0.001f;
+float SVFFilter::processSample(float input)
+{
+    if (rampSamples > 0)
+    {
+        g = (--rampSamples == 0) ? gTarget : g * gRatio;
+        updateGains();
+    }
 
-    v0 = input;
+    const float output = integrate(input, ic1eq, ic2eq);
+    ic1eqRight = ic1eq;
+    ic2eqRight = ic2eq;
+    return output;
+}
 
-    // Integrator 1
-    float v1_new = v1 + fs * v3;
-    v3 = fs * (v0 - v1 - q * v1);
+void SVFFilter::processStereoSample(float& left, float& right)
+{
+    if (rampSamples > 0)
+    {
+        g = (--rampSamples == 0) ? gTarget : g * gRatio;
+        updateGains();
+    }
 
-    // Integrator 2
-    float v2_new = v2 + fs * v1;
-    v1 = v1_new;
-    v2 = v2_new;
+    left = integrate(left, ic1eq, ic2eq);
+    right = integrate(right, ic1eqRight, ic2eqRight);
+}
 
-    // Outputs
-    float lowpass = v2;
-    float bandpass = v1;
-    float highpass = v0 - q * v1 - v2;
-    float notch = v0 - q * v1;
+float SVFFilter::integrate(float input, float& ic1, float& ic2) const
+{
+    // Trapezoidal-integrated SVF (Simper): no unit delay in the feedback path
+    const float v3 = input - ic2;
+    const float v1 = a1 * ic1 + a2 * v3;
+    const float v2 = ic2 + a2 * ic1 + a3 * v3;
+    ic1 = 2.0f * v1 - ic1;
+    ic2 = 2.0f * v2 - ic2;
 
     // Select output based on type
     switch (type)
     {
         case FilterType::LOWPASS:
-            return lowpass;
+            return v2;
         case FilterType::HIGHPASS:
-            return highpass;
+            return input - k * v1 - v2;
         case FilterType::BANDPASS:
-            return bandpass;
+            return v1;
         case FilterType::NOTCH:
-            return notch;
+            return input - k * v1;
         default:
-            return lowpass;
+            return v2;
     }
 }
 
@@ -381,92 +967,199 @@ Envelope::Envelope()
     : state(State::IDLE)
     , currentLevel(0.0f)
 {
+    updateIncrements();
 }
 
 void Envelope::prepare(double sampleRate)
 {
     sampleRate_ = sampleRate;
+    updateIncrements();
     reset();
 }
 
 void Envelope::reset()
 {
-    state = State::IDLE;
     currentLevel = 0.0f;
+    startStage(State::IDLE);
 }
 
 void Envelope::setParameters(const Parameters& p)
 {
+    const bool timesChanged = p.attack != params.attack || p.decay != params.decay
+                           || p.sustain != params.sustain || p.release != params.release;
+
     params.attack = p.attack;
     params.decay = p.decay;
     params.sustain = p.sustain;
     params.release = p.release;
+
+    if (timesChanged)
+    {
+        updateIncrements();
+
+        // re-plan the running ramp from where it is
+        if (segmentLength > 0)
+            startStage(state);
+    }
 }
 
 void Envelope::noteOn()
 {
-    state = State::ATTACK;
+    startStage(State::ATTACK);
 }
 
 void Envelope::noteOff()
 {
     if (state != State::IDLE)
-        state = State::RELEASE;
+        startStage(State::RELEASE);
 }
 
-float Envelope::processSample()
+void Envelope::updateIncrements()
 {
-    float increment = 1.0f / static_cast<float>(sampleRate_);
+    // a zero time jumps to the end of the stage in one sample
+    const float tick = 1.0f / static_cast<float>(sampleRate_);
+    attackIncrement = (params.attack > 0.0f) ? tick / params.attack : 1.0f;
+    decayIncrement = (params.decay > 0.0f) ? tick / params.decay : 1.0f;
+    releaseIncrement = (params.release > 0.0f) ? tick / params.release : 1.0f;
+}
+
+void Envelope::startStage(State newState)
+{
+    state = newState;
+    segmentStart = currentLevel;
+    segmentPosition = 0;
 
     switch (state)
     {
         case State::ATTACK:
-            currentLevel += increment / params.attack;
-            if (currentLevel >= 1.0f)
-            {
-                currentLevel = 1.0f;
-                state = State::DECAY;
-            }
+            segmentTarget = 1.0f;
+            segmentStep = attackIncrement;
             break;
 
         case State::DECAY:
-            currentLevel -= increment / params.decay;
-            if (currentLevel <= params.sustain)
-            {
-                currentLevel = params.sustain;
-                state = State::SUSTAIN;
-            }
-            break;
-
-        case State::SUSTAIN:
-            currentLevel = params.sustain;
+            segmentTarget = params.sustain;
+            segmentStep = -decayIncrement;
             break;
 
         case State::RELEASE:
-            currentLevel -= increment / params.release;
-            if (currentLevel <= 0.0f)
-            {
-                currentLevel = 0.0f;
-                state = State::IDLE;
-            }
+            segmentTarget = 0.0f;
+            segmentStep = -releaseIncrement;
             break;
 
+        case State::SUSTAIN:
         case State::IDLE:
-            currentLevel = 0.0f;
-            break;
+            segmentLength = 0;
+            return;
     }
 
-    return currentLevel;
+    // samples until the ramp reaches (or passes) its target, at least one
+    const double samplesToTarget = std::ceil(static_cast<double>(segmentTarget - segmentStart) / segmentStep);
+    segmentLength = static_cast<int>(std::max(1.0, std::min(samplesToTarget, 2147483647.0)));
 }
 
-bool Envelope::isActive() const
+void Envelope::endSegment()
 {
-    return state != State::IDLE;
+    currentLevel = segmentTarget;
+
+    switch (state)
+    {
+        case State::ATTACK:  startStage(State::DECAY); break;
+        case State::DECAY:   startStage(State::SUSTAIN); break;
+        case State::RELEASE: startStage(State::IDLE); break;
+        default: break;
+    }
 }
 
-//==============================================================================
-// LFO IMPLEMENTATION
-//==============================================================================
+float Envelope::processSample()
+{
+    if (segmentLength == 0)
+    {
+        currentLevel = (state == State::SUSTAIN) ? params.sustain : 0.0f;
+        return currentLevel;
+    }
+
+    if (++segmentPosition < segmentLength)
+        currentLevel = segmentStart + segmentStep * static_cast<float>(segmentPosition);
+    else
+        endSegment();
+
+    return currentLevel;
+}
+
+void Envelope::processBlock(float* output, int numSamples)
+{
+    int i = 0;
+
+    while (i < numSamples)
+    {
+        // sustain and idle hold for the rest of the block
+        if (segmentLength == 0)
+        {
+            currentLevel = (state == State::SUSTAIN) ? params.sustain : 0.0f;
+            std::fill(output + i, output + numSamples, currentLevel);
+            return;
+        }
+
+        // the ramp up to (not including) the segment's last sample
+        const int numRamp = std::min(numSamples - i, segmentLength - segmentPosition - 1);
+        const float start = segmentStart;
+        const float step = segmentStep;
+        const int position = segmentPosition;
+
+        for (int n = 1; n <= numRamp; ++n)
+            output[i + n - 1] = start + step * static_cast<float>(position + n);
+
+        i += numRamp;
+        segmentPosition += numRamp;
+
+        if (numRamp > 0)
+            currentLevel = output[i - 1];
+
+        // the last sample lands on the target and the next stage starts
+        if (i < numSamples)
+        {
+            ++segmentPosition;
+            endSegment();
+            output[i++] = currentLevel;
+        }
+    }
+}
+
+float Envelope::advance(int numSamples)
+{
+    while (numSamples > 0)
+    {
+        if (segmentLength == 0)
+        {
+            currentLevel = (state == State::SUSTAIN) ? params.sustain : 0.0f;
+            break;
+        }
+
+        // inside the segment: the same level processSample would reach
+        const int remaining = segmentLength - segmentPosition;
+        if (numSamples < remaining)
+        {
+            segmentPosition += numSamples;
+            currentLevel = segmentStart + segmentStep * static_cast<float>(segmentPosition);
+            break;
+        }
+
+        numSamples -= remaining;
+        segmentPosition = segmentLength;
+        endSegment();
+    }
+
+    return currentLevel;
+}
+
+bool Envelope::isActive() const
+{
+    return state != State::IDLE;
+}
+
+//==============================================================================
+// LFO IMPLEMENTATION
+//==============================================================================
 
 LFO::LFO()
     : phase(0.0)
@@ -486,8 +1179,9 @@ void LFO::prepare(double sampleRate)
 
 void LFO::reset()
 {
+    // Running state only: the rate (phaseIncrement) is a parameter and
+    // survives a reset
     phase = 0.0;
-    phaseIncrement = 0.0;
     output = 0.0f;
     lastSandHValue = 0.0f;
 }
@@ -519,8 +1213,8 @@ float LFO::processSample()
 
     // Advance phase
     phase += phaseIncrement;
-    if (phase >= 1.0)
-        phase -= 1.0;
+    if (phase >= 1.0f)
+        phase -= 1.0f;
 
     // Apply depth and bipolar/unipolar
     float scaledOutput = output * depth;
@@ -530,6 +1224,27 @@ float LFO::processSample()
     return scaledOutput;
 }
 
+float LFO::advance(int numSamples)
+{
+    output = generateWaveform();
+
+    phase += phaseIncrement * numSamples;
+    if (phase >= 1.0)
+    {
+        phase -= std::floor(phase);
+
+        // a new sample-and-hold step at every cycle start passed
+        if (waveform == LFOWaveform::SAMPLE_AND_HOLD)
+            lastSandHValue = distribution_(generator_) * 2.0f - 1.0f;
+    }
+
+    float scaledOutput = output * depth;
+    if (!bipolar)
+        scaledOutput = (scaledOutput + 1.0f) * 0.5f;
+
+    return scaledOutput;
+}
+
 float LFO::generateWaveform()
 {
     double p = phase;
@@ -602,6 +1317,76 @@ void ModulationMatrix::setSlot(int index, const ModulationSlot& slot)
         slots[index].bipolar = slot.bipolar;
         slots[index].curveType = slot.curveType;
         slots[index].maxValue = slot.maxValue;
+
+        compile();
+    }
+}
+
+bool ModulationMatrix::isVoiceDestination(ModDestination destination)
+{
+    switch (destination)
+    {
+        case ModDestination::OSC1_FREQ:
+        case ModDestination::OSC1_WARP:
+        case ModDestination::OSC1_PULSE_WIDTH:
+        case ModDestination::OSC1_LEVEL:
+        case ModDestination::OSC2_FREQ:
+        case ModDestination::OSC2_WARP:
+        case ModDestination::OSC2_PULSE_WIDTH:
+        case ModDestination::OSC2_LEVEL:
+        case ModDestination::SUB_LEVEL:
+        case ModDestination::NOISE_LEVEL:
+        case ModDestination::FILTER_CUTOFF:
+        case ModDestination::FILTER_RESONANCE:
+            return true;
+
+        default:
+            return false;  // envelope times and LFO settings are not per voice
+    }
+}
+
+void ModulationMatrix::compile()
+{
+    numRoutes_ = 0;
+
+    for (const auto& slot : slots)
+    {
+        const float amount = slot.amount.load();
+        if (amount == 0.0f || !isVoiceDestination(slot.destination))
+            continue;
+
+        const bool bipolarSource = slot.source == ModSource::LFO1
+                                || slot.source == ModSource::LFO2
+                                || slot.source == ModSource::PITCH_WHEEL;
+
+        auto& route = routes_[static_cast<size_t>(numRoutes_++)];
+        route.source = static_cast<int>(slot.source);
+        route.destination = static_cast<int>(slot.destination);
+        route.amount = amount;
+        route.toUnipolar = bipolarSource && !slot.bipolar;
+        route.curveType = slot.curveType;
+    }
+}
+
+void ModulationMatrix::advanceSources(int numSamples)
+{
+    sourceValues[static_cast<int>(ModSource::LFO1)] = lfo1.advance(numSamples);
+    sourceValues[static_cast<int>(ModSource::LFO2)] = lfo2.advance(numSamples);
+}
+
+void ModulationMatrix::evaluate(const float* sources, float* destinations) const
+{
+    std::fill(destinations, destinations + numModDestinations, 0.0f);
+
+    for (int r = 0; r < numRoutes_; ++r)
+    {
+        const auto& route = routes_[static_cast<size_t>(r)];
+
+        float value = sources[route.source];
+        if (route.toUnipolar)
+            value = value * 0.5f + 0.5f;
+
+        destinations[route.destination] += applyCurve(value, route.curveType) * route.amount;
     }
 }
 
@@ -709,37 +1494,142 @@ std::string MacroSystem::getMacroName(int macroIndex) const
 void MacroSystem::addDestination(int macroIndex, const std::string& paramID,
                                  float amount, float minVal, float maxVal)
 {
-    if (macroIndex >= 0 && macroIndex < 8)
+    const int paramIndex = MotionPureDSP::getParameterIndex(paramID.c_str());
+    if (paramIndex >= 0)
+        addDestination(macroIndex, paramIndex, amount, minVal, maxVal);
+}
+
+void MacroSystem::addDestination(int macroIndex, int paramIndex,
+                                 float amount, float minVal, float maxVal)
+{
+    if (macroIndex < 0 || macroIndex >= numMacros || paramIndex < 0 || paramIndex >= MotionPureDSP::getNumParameters())
+        return;
+
+    auto& macro = macros[macroIndex];
+    if (macro.numDestinations < maxDestinations)
     {
-        auto& macro = macros[macroIndex];
-        if (macro.numDestinations < 4)
-        {
-            macro.destinations[macro.numDestinations] = { paramID, amount, minVal, maxVal };
-            macro.numDestinations++;
-        }
+        auto& destination = macro.destinations[macro.numDestinations];
+        destination.paramID = MotionPureDSP::getParameterId(paramIndex);
+        destination.paramIndex = paramIndex;
+        destination.amount = amount;
+        destination.minValue = minVal;
+        destination.maxValue = maxVal;
+        macro.numDestinations++;
+
+        compileRoutes();
     }
 }
 
-float MacroSystem::applyMacroModulation(const std::string& paramID, float baseValue) const
+void MacroSystem::clearDestinations(int macroIndex)
+{
+    if (macroIndex >= 0 && macroIndex < numMacros)
+    {
+        macros[macroIndex].numDestinations = 0;
+        compileRoutes();
+    }
+}
+
+void MacroSystem::compileRoutes()
 {
-    float totalModulation = 0.0f;
+    // Group the destinations by parameter: each target owns a contiguous
+    // run of routes, one per macro destination that reaches it
+    numTargets_ = 0;
+    int numRoutes = 0;
 
-    for (const auto& macro : macros)
+    for (int m = 0; m < numMacros; ++m)
     {
-        for (int i = 0; i < macro.numDestinations; ++i)
+        for (int d = 0; d < macros[m].numDestinations; ++d)
         {
-            if (macro.destinations[i].paramID == paramID)
+            const auto& destination = macros[m].destinations[d];
+
+            int t = 0;
+            while (t < numTargets_ && targets_[t].paramIndex != destination.paramIndex)
+                ++t;
+
+            if (t == numTargets_)
             {
-                // Map macro value to parameter range
-                float modValue = macro.value;
-                float range = macro.destinations[i].maxValue - macro.destinations[i].minValue;
-                float offset = macro.destinations[i].amount * modValue * range;
-                totalModulation += offset;
+                targets_[numTargets_++] = { destination.paramIndex, 0, 0 };
             }
+            targets_[t].numRoutes++;
+        }
+    }
+
+    for (int t = 0; t < numTargets_; ++t)
+    {
+        targets_[t].firstRoute = numRoutes;
+        numRoutes += targets_[t].numRoutes;
+        targets_[t].numRoutes = 0;
+    }
+
+    for (int m = 0; m < numMacros; ++m)
+    {
+        for (int d = 0; d < macros[m].numDestinations; ++d)
+        {
+            const auto& destination = macros[m].destinations[d];
+
+            int t = 0;
+            while (targets_[t].paramIndex != destination.paramIndex)
+                ++t;
+
+            auto& route = routes_[targets_[t].firstRoute + targets_[t].numRoutes++];
+            route.macro = m;
+            route.scale = destination.amount * (destination.maxValue - destination.minValue);
         }
     }
+}
+
+float MacroSystem::getModulation(int paramIndex) const
+{
+    for (int t = 0; t < numTargets_; ++t)
+    {
+        if (targets_[t].paramIndex != paramIndex)
+            continue;
+
+        float offset = 0.0f;
+        for (int r = targets_[t].firstRoute; r < targets_[t].firstRoute + targets_[t].numRoutes; ++r)
+            offset += routes_[r].scale * macros[routes_[r].macro].value;
+        return offset;
+    }
+
+    return 0.0f;
+}
+
+float MacroSystem::applyMacroModulation(const std::string& paramID, float baseValue) const
+{
+    // Convenience for non-realtime callers; the audio path uses indices
+    return applyMacroModulation(MotionPureDSP::getParameterIndex(paramID.c_str()), baseValue);
+}
+
+int MacroSystem::evaluate(int* paramIndices, float* offsets) const
+{
+    for (int t = 0; t < numTargets_; ++t)
+    {
+        float offset = 0.0f;
+        for (int r = targets_[t].firstRoute; r < targets_[t].firstRoute + targets_[t].numRoutes; ++r)
+            offset += routes_[r].scale * macros[routes_[r].macro].value;
+
+        paramIndices[t] = targets_[t].paramIndex;
+        offsets[t] = offset;
+    }
+
+    return numTargets_;
+}
+
+int MacroSystem::getDestinations(int macroIndex, int* paramIndices) const
+{
+    if (macroIndex < 0 || macroIndex >= numMacros)
+        return 0;
+
+    int count = 0;
+    const auto& macro = macros[macroIndex];
+    for (int d = 0; d < macro.numDestinations; ++d)
+    {
+        const int index = macro.destinations[d].paramIndex;
+        if (std::find(paramIndices, paramIndices + count, index) == paramIndices + count)
+            paramIndices[count++] = index;
+    }
 
-    return baseValue + totalModulation;
+    return count;
 }
 
 //==============================================================================
@@ -763,6 +1653,8 @@ void Voice::reset()
 {
     osc1.reset();
     osc2.reset();
+    osc1Unison.reset();
+    osc2Unison.reset();
     subOsc.reset();
     filter.reset();
     filterEnv.reset();
@@ -776,6 +1668,10 @@ void Voice::noteOn(int note, float vel, double currentSampleRate)
     velocity = vel;
     active = true;
 
+    // modulation offsets restart from the next control block
+    std::fill(std::begin(modGain), std::end(modGain), 0.0f);
+    std::fill(std::begin(modGainStep), std::end(modGainStep), 0.0f);
+
     // Calculate base frequency
     float freq = static_cast<float>(midiToFrequency(note, 0.0));
 
@@ -791,6 +1687,7 @@ void Voice::noteOn(int note, float vel, double currentSampleRate)
 
 void Voice::noteOff(float vel)
 {
+    active = false;
     filterEnv.noteOff();
     ampEnv.noteOff();
 }
@@ -800,12 +1697,26 @@ bool Voice::isActive() const
     return active || ampEnv.isActive() || filterEnv.isActive();
 }
 
-float Voice::renderSample()
+void Voice::updateFilterModulation(int numSamples)
+{
+    // envelope level at the end of the chunk; the cutoff ramps there
+    const float envelope = filterEnv.advance(numSamples);
+
+    const float octaves = filterEnvelopeAmount * filterEnvelopeOctaves * envelope
+                        + filterKeyTrack * static_cast<float>(midiNote - 60) / 12.0f
+                        + filterVelocityTrack * (velocity - 1.0f) * velocityTrackOctaves;
+
+    filter.setModulation(octaves, numSamples);
+}
+
+void Voice::renderSample(float& left, float& right)
 {
+    left = right = 0.0f;
+
     // FIX: Check if voice should be silent
     // Voice is active if note is on OR envelopes are still processing
     if (!active && !ampEnv.isActive() && !filterEnv.isActive())
-        return 0.0f;
+        return;
 
     // FM synthesis
     float fmModulation = 0.0f;
@@ -825,277 +1736,946 @@ float Voice::renderSample()
         }
     }
 
-    // Generate oscillator outputs
-    float osc1Out = (fmEnabled && fmCarrierIndex == 0) ?
-        osc1.processSampleWithFM(fmModulation) : osc1.processSample();
+    // Generate oscillator outputs (a unison stack replaces its oscillator)
+    const bool fm1 = fmEnabled && fmCarrierIndex == 0;
+    const bool fm2 = fmEnabled && fmCarrierIndex == 1;
+
+    float osc1Out = 0.0f;
+    float osc1Right = 0.0f;
+    if (osc1Unison.isStereo())
+        osc1Unison.processStereoSample(osc1, fm1 ? osc1.fmDepth * fmModulation : 0.0f, osc1Out, osc1Right);
+    else
+        osc1Out = osc1Right = osc1Unison.isActive() ? osc1Unison.processSample(osc1, fm1 ? osc1.fmDepth * fmModulation : 0.0f)
+                            : fm1 ? osc1.processSampleWithFM(fmModulation) : osc1.processSample();
+
+    float osc2Out = 0.0f;
+    float osc2Right = 0.0f;
+    if (osc2Unison.isStereo())
+        osc2Unison.processStereoSample(osc2, fm2 ? osc2.fmDepth * fmModulation : 0.0f, osc2Out, osc2Right);
+    else
+        osc2Out = osc2Right = osc2Unison.isActive() ? osc2Unison.processSample(osc2, fm2 ? osc2.fmDepth * fmModulation : 0.0f)
+                            : fm2 ? osc2.processSampleWithFM(fmModulation) : osc2.processSample();
+
+    // Levels with the modulation matrix offsets
+    float level1 = osc1Level;
+    float level2 = osc2Level;
+    float levelSub = subLevel;
+    float levelNoise = noiseLevel;
+
+    if (modulated)
+    {
+        for (int g = 0; g < numModGains; ++g)
+            modGain[g] += modGainStep[g];
 
-    float osc2Out = (fmEnabled && fmCarrierIndex == 1) ?
-        osc2.processSampleWithFM(fmModulation) : osc2.processSample();
+        level1 = std::max(0.0f, osc1Level + modGain[modOsc1Gain]);
+        level2 = std::max(0.0f, osc2Level + modGain[modOsc2Gain]);
+        levelSub = std::max(0.0f, subLevel + modGain[modSubGain]);
+        levelNoise = std::max(0.0f, noiseLevel + modGain[modNoiseGain]);
+    }
 
-    // Mix oscillators
-    float mix = (osc1Out * osc1Level) + (osc2Out * osc2Level);
+    // Mix oscillators; sub and noise sit in the centre
+    float mix = (osc1Out * level1) + (osc2Out * level2);
+    float mixRight = (osc1Right * level1) + (osc2Right * level2);
 
     // Add sub-oscillator if enabled
     if (subOsc.enabled)
     {
-        float subOut = subOsc.processSample();
-        mix += subOut * subLevel;
+        float subOut = subOsc.processSample() * levelSub;
+        mix += subOut;
+        mixRight += subOut;
     }
 
     // Add noise
-    if (noiseLevel > 0.0f)
+    if (levelNoise > 0.0f)
     {
-        mix += noiseGen.nextFloat() * noiseLevel;
+        float noiseOut = noiseGen.nextFloat() * levelNoise;
+        mix += noiseOut;
+        mixRight += noiseOut;
     }
 
-    // Process through filter
-    float filtered = filter.processSample(mix);
-
-    // Apply filter envelope modulation
-    float filterEnvValue = filterEnv.processSample();
-    float filterMod = filterEnvValue * filterEnvelopeAmount;
+    // Process through filter (cutoff ramp set by updateFilterModulation)
+    if (isStereo())
+    {
+        filter.processStereoSample(mix, mixRight);
+    }
+    else
+    {
+        mix = filter.processSample(mix);
+        mixRight = mix;
+    }
 
     // Apply amp envelope
     float ampEnvValue = ampEnv.processSample();
-    filtered *= ampEnvValue;
-
-    return filtered;
+    left = mix * ampEnvValue;
+    right = mixRight * ampEnvValue;
 }
 
 //==============================================================================
-// VOICE MANAGER IMPLEMENTATION
+// VOICE LANE GROUP IMPLEMENTATION
 //==============================================================================
 
-VoiceManager::VoiceManager()
-    : monoVoiceIndex_(-1)
-    , glideEnabled_(false)
-    , glideTime_(0.1f)
-    , currentSampleRate_(48000.0)
+namespace
 {
-}
+    namespace FastMath = SchillingerEcosystem::DSP::FastMath;
 
-void VoiceManager::prepare(double sampleRate, int samplesPerBlock)
-{
-    currentSampleRate_ = sampleRate;
+    constexpr int kLanes = VoiceLaneGroup::numLanes;
 
-    for (auto& voice : voices_)
+    // Oscillator::polyBlep with selects instead of branches, so it vectorises;
+    // invDt is 1 / dt, taken once per block
+    inline float lanePolyBlep(float t, float dt, float invDt)
     {
-        voice.prepare(sampleRate);
-        // Initialize modMatrix pointer for each voice
-        // Note: This is a temporary fix - ideally the Voice structure
-        // should be refactored to store a reference or index to the modMatrix
-        // rather than a raw pointer that needs to be manually set
+        const float a = t * invDt;
+        const float b = (t - 1.0f) * invDt;
+        return (t < dt) ? (a + a - a * a - 1.0f)
+             : (t > 1.0f - dt) ? (b + b + b * b + 1.0f)
+             : 0.0f;
     }
-}
 
-void VoiceManager::reset()
-{
-    for (auto& voice : voices_)
+    inline float laneWrap(float p)
     {
-        voice.reset();
+        return p - std::floor(p);
     }
-    monoVoiceIndex_ = -1;
-}
 
-Voice* VoiceManager::findFreeVoice()
-{
-    // Find inactive voice
-    for (int i = 0; i < 16; ++i)
+    // One Oscillator::generateWaveform per lane; phaseOffset carries FM.
+    // The wavetable engine reads each lane's own table selection.
+    void laneOscillator(Waveform waveform, const float* warp, const float* pulseWidth, const Oscillator* const* oscs,
+                        const float* phase, const float* phaseInc, const float* invPhaseInc,
+                        const float* phaseOffset, float* out)
     {
-        if (!voices_[i].isActive())
+        if (oscs[0]->engine == OscillatorEngine::WAVETABLE)
         {
-            return &voices_[i];
+            for (int l = 0; l < kLanes; ++l)
+                out[l] = (oscs[l] != nullptr) ? oscs[l]->renderWavetable(static_cast<double>(phase[l]) + phaseOffset[l]) : 0.0f;
+            return;
         }
-    }
 
-    // Voice stealing: steal oldest voice
-    int oldestVoice = 0;
-    double oldestTime = voices_[0].startTime;
+        bool warped = false;
+        for (int l = 0; l < kLanes; ++l)
+            warped = warped || warp[l] != 0.0f;
 
-    for (int i = 1; i < 16; ++i)
-    {
-        if (voices_[i].startTime < oldestTime)
+        alignas(32) float p[kLanes];
+        if (warped)
         {
-            oldestTime = voices_[i].startTime;
-            oldestVoice = i;
+            for (int l = 0; l < kLanes; ++l)
+            {
+                const float modulated = phase[l] + phaseOffset[l];
+                const float warpSine = FastMath::sin2Pi(laneWrap(modulated));
+                p[l] = laneWrap(modulated + warp[l] * warpSine);
+            }
+        }
+        else
+        {
+            // no lane warps: skip the sine
+            for (int l = 0; l < kLanes; ++l)
+                p[l] = laneWrap(phase[l] + phaseOffset[l]);
         }
-    }
 
-    return &voices_[oldestVoice];
-}
+        switch (waveform)
+        {
+            case Waveform::SAW:
+                for (int l = 0; l < kLanes; ++l)
+                    out[l] = 2.0f * p[l] - 1.0f - lanePolyBlep(p[l], phaseInc[l], invPhaseInc[l]);
+                break;
+
+            case Waveform::SQUARE:
+                for (int l = 0; l < kLanes; ++l)
+                {
+                    const float naive = (p[l] < 0.5f) ? 1.0f : -1.0f;
+                    out[l] = naive + lanePolyBlep(p[l], phaseInc[l], invPhaseInc[l])
+                                   - lanePolyBlep(laneWrap(p[l] + 0.5f), phaseInc[l], invPhaseInc[l]);
+                }
+                break;
+
+            case Waveform::TRIANGLE:
+                for (int l = 0; l < kLanes; ++l)
+                    out[l] = 2.0f * std::abs(2.0f * p[l] - 1.0f) - 1.0f;
+                break;
+
+            case Waveform::SINE:
+                for (int l = 0; l < kLanes; ++l)
+                    out[l] = FastMath::sin2Pi(p[l]);
+                break;
+
+            case Waveform::PULSE:
+                for (int l = 0; l < kLanes; ++l)
+                {
+                    const float naive = (p[l] < pulseWidth[l]) ? 1.0f : -1.0f;
+                    out[l] = naive + lanePolyBlep(p[l], phaseInc[l], invPhaseInc[l])
+                                   - lanePolyBlep(laneWrap(p[l] + (1.0f - pulseWidth[l])), phaseInc[l], invPhaseInc[l]);
+                }
+                break;
+        }
+    }
 
-Voice* VoiceManager::findVoiceForNote(int note)
-{
-    for (int i = 0; i < 16; ++i)
+    inline void laneAdvance(float* phase, const float* phaseInc)
     {
-        if (voices_[i].midiNote == note && voices_[i].isActive())
+        for (int l = 0; l < kLanes; ++l)
         {
-            return &voices_[i];
+            const float p = phase[l] + phaseInc[l];
+            phase[l] = (p >= 1.0f) ? p - 1.0f : p;
         }
     }
-    return nullptr;
 }
 
-void VoiceManager::handleNoteOn(int note, float velocity)
+void VoiceLaneGroup::gather(Voice* const* voicesIn, int count)
 {
-    if (polyMode_ == PolyphonyMode::MONO || polyMode_ == PolyphonyMode::LEGATO)
+    numVoices = count;
+    modulated = false;
+
+    for (int l = 0; l < numLanes; ++l)
     {
-        // Monophonic/legato mode
-        if (monoVoiceIndex_ == -1)
+        if (l < count)
         {
-            Voice* voice = findFreeVoice();
-            if (voice)
+            Voice& v = *voicesIn[l];
+            voices[l] = &v;
+
+            osc1Phase[l] = v.osc1.phase;
+            osc1Inc[l] = v.osc1.phaseIncrement;
+            osc2Phase[l] = v.osc2.phase;
+            osc2Inc[l] = v.osc2.phaseIncrement;
+            subPhase[l] = v.subOsc.phase;
+            subInc[l] = v.subOsc.phaseIncrement;
+
+            osc1Warp[l] = v.osc1.warp;
+            osc2Warp[l] = v.osc2.warp;
+            osc1PulseWidth[l] = v.osc1.pulseWidth;
+            osc2PulseWidth[l] = v.osc2.pulseWidth;
+
+            for (int g = 0; g < Voice::numModGains; ++g)
             {
-                voice->noteOn(note, velocity, currentSampleRate_);
-                monoVoiceIndex_ = static_cast<int>(voice - voices_.data());
+                modGain[g][l] = v.modGain[g];
+                modGainStep[g][l] = v.modulated ? v.modGainStep[g] : 0.0f;
             }
+            modulated = modulated || v.modulated;
+
+            filterIc1[l] = v.filter.ic1eq;
+            filterIc2[l] = v.filter.ic2eq;
+            filterIc1Right[l] = v.filter.ic1eqRight;
+            filterIc2Right[l] = v.filter.ic2eqRight;
+
+            noiseState[l] = v.laneNoiseState;
         }
         else
         {
-            if (polyMode_ == PolyphonyMode::LEGATO)
-            {
-                // Legato: change pitch without retriggering envelopes
-                voices_[monoVoiceIndex_].midiNote = note;
-                float freq = static_cast<float>(midiToFrequency(note, 0.0));
-                voices_[monoVoiceIndex_].osc1.setFrequency(freq, currentSampleRate_);
-                voices_[monoVoiceIndex_].osc2.setFrequency(freq, currentSampleRate_);
-                voices_[monoVoiceIndex_].subOsc.setFrequency(freq, currentSampleRate_);
-            }
-            else
-            {
-                // Mono: retrigger
-                voices_[monoVoiceIndex_].noteOn(note, velocity, currentSampleRate_);
-            }
+            // unused lanes run silent: no envelope, no phase movement
+            voices[l] = nullptr;
+            osc1Phase[l] = osc2Phase[l] = subPhase[l] = 0.0f;
+            osc1Inc[l] = osc2Inc[l] = subInc[l] = 0.0f;
+            osc1Warp[l] = osc2Warp[l] = 0.0f;
+            osc1PulseWidth[l] = osc2PulseWidth[l] = 0.5f;
+            filterG[l] = filterGTarget[l] = 0.0f;
+            filterGRatio[l] = 1.0f;
+            filterK[l] = 1.0f;
+            for (int g = 0; g < Voice::numModGains; ++g)
+                modGain[g][l] = modGainStep[g][l] = 0.0f;
+            filterIc1[l] = filterIc2[l] = 0.0f;
+            filterIc1Right[l] = filterIc2Right[l] = 0.0f;
+            std::fill(ampEnvelope[l], ampEnvelope[l] + envelopeChunk, 0.0f);
+            noiseState[l] = 0x9E3779B9u;
         }
     }
-    else
+}
+
+void VoiceLaneGroup::scatter()
+{
+    for (int l = 0; l < numVoices; ++l)
     {
-        // Polyphonic
-        Voice* voice = findFreeVoice();
-        if (voice)
-        {
-            voice->noteOn(note, velocity, currentSampleRate_);
-        }
+        Voice& v = *voices[l];
+
+        v.osc1.phase = osc1Phase[l];
+        v.osc2.phase = osc2Phase[l];
+        v.subOsc.phase = subPhase[l];
+
+        if (v.modulated)
+            for (int g = 0; g < Voice::numModGains; ++g)
+                v.modGain[g] = modGain[g][l];
+
+        v.filter.ic1eq = filterIc1[l];
+        v.filter.ic2eq = filterIc2[l];
+        v.filter.ic1eqRight = filterIc1Right[l];
+        v.filter.ic2eqRight = filterIc2Right[l];
+
+        v.laneNoiseState = noiseState[l];
     }
 }
 
-void VoiceManager::handleNoteOff(int note)
+void VoiceLaneGroup::render(float* left, float* right, int numSamples)
 {
-    if (polyMode_ == PolyphonyMode::MONO || polyMode_ == PolyphonyMode::LEGATO)
+    if (numVoices == 0)
+        return;
+
+    // Parameters are shared by every voice (see updateVoiceParameters)
+    const Voice& ref = *voices[0];
+
+    const Waveform wave1 = ref.osc1.waveform;
+    const Waveform wave2 = ref.osc2.waveform;
+
+    const bool fm = ref.fmEnabled;
+    const int carrier = ref.fmCarrierIndex;
+    const float modDepth = ref.fmDepth;
+    const float carrierDepth = (carrier == 0) ? ref.osc1.fmDepth : ref.osc2.fmDepth;
+
+    // Unison stacks run per voice, each one vector kernel over its copies;
+    // a spread stack makes the group stereo (see Voice::renderSample)
+    const bool unison1 = ref.osc1Unison.isActive();
+    const bool unison2 = ref.osc2Unison.isActive();
+    const bool stereo1 = ref.osc1Unison.isStereo();
+    const bool stereo2 = ref.osc2Unison.isStereo();
+    const bool stereo = stereo1 || stereo2;
+
+    const float osc1Level = ref.osc1Level;
+    const float osc2Level = ref.osc2Level;
+    const bool subEnabled = ref.subOsc.enabled;
+    const float subOscLevel = ref.subOsc.level;
+    const float subLevel = ref.subLevel;
+    const float noiseLevel = ref.noiseLevel;
+    const bool noiseOn = noiseLevel > 0.0f || modulated;
+
+    const FilterType filterType = ref.filter.type;
+
+    alignas(32) float osc1InvInc[numLanes];
+    alignas(32) float osc2InvInc[numLanes];
+    for (int l = 0; l < numLanes; ++l)
     {
-        // Check if this is the current mono voice
-        if (monoVoiceIndex_ >= 0 && voices_[monoVoiceIndex_].midiNote == note)
-        {
-            voices_[monoVoiceIndex_].noteOff(0.0f);
-        }
+        osc1InvInc[l] = (osc1Inc[l] > 0.0f) ? 1.0f / osc1Inc[l] : 0.0f;
+        osc2InvInc[l] = (osc2Inc[l] > 0.0f) ? 1.0f / osc2Inc[l] : 0.0f;
     }
-    else
+
+    const Oscillator* osc1s[numLanes];
+    const Oscillator* osc2s[numLanes];
+    for (int l = 0; l < numLanes; ++l)
     {
-        // Find and release voice
-        Voice* voice = findVoiceForNote(note);
-        if (voice)
-        {
-            voice->noteOff(0.0f);
-        }
+        osc1s[l] = (l < numVoices) ? &voices[l]->osc1 : nullptr;
+        osc2s[l] = (l < numVoices) ? &voices[l]->osc2 : nullptr;
     }
-}
 
-void VoiceManager::allNotesOff()
-{
-    for (auto& voice : voices_)
+    alignas(32) float zeroOffset[numLanes] {};
+    alignas(32) float fmOffset[numLanes] {};
+    alignas(32) float mod[numLanes];
+    alignas(32) float o1[numLanes];
+    alignas(32) float o2[numLanes];
+    alignas(32) float o1Right[numLanes];
+    alignas(32) float o2Right[numLanes];
+    alignas(32) float y[numLanes];
+    alignas(32) float yRight[numLanes] {};
+
+    // Levels per lane (Voice::renderSample with the modulation offsets)
+    alignas(32) float gain1[numLanes];
+    alignas(32) float gain2[numLanes];
+    alignas(32) float gainSub[numLanes];
+    alignas(32) float gainNoise[numLanes];
+    for (int l = 0; l < numLanes; ++l)
     {
-        voice.noteOff(0.0f);
+        gain1[l] = osc1Level;
+        gain2[l] = osc2Level;
+        gainSub[l] = subOscLevel * subLevel;
+        gainNoise[l] = noiseLevel;
     }
-}
 
-void VoiceManager::processBlock(float* output, int numSamples, double sampleRate)
-{
-    // Render all active voices
-    for (int i = 0; i < numSamples; ++i)
+    for (int chunkStart = 0; chunkStart < numSamples; chunkStart += envelopeChunk)
     {
-        float mix = 0.0f;
+        const int chunkSamples = std::min(envelopeChunk, numSamples - chunkStart);
 
-        for (auto& voice : voices_)
+        // Envelopes for the chunk (one segment loop per voice) and the
+        // cutoff ramp they set
+        bool filterRamping = false;
+        for (int l = 0; l < numVoices; ++l)
         {
-            if (voice.isActive())
-            {
-                mix += voice.renderSample();
-            }
+            Voice& v = *voices[l];
+            v.updateFilterModulation(chunkSamples);
+            v.ampEnv.processBlock(ampEnvelope[l], chunkSamples);
+
+            filterG[l] = v.filter.g;
+            filterGRatio[l] = v.filter.gRatio;
+            filterGTarget[l] = v.filter.gTarget;
+            filterK[l] = v.filter.k;
+            filterRamping = filterRamping || v.filter.rampSamples > 0;
         }
 
-        output[i] = mix;
+        // SVFFilter::updateGains, per sample only while a cutoff moves
+        alignas(32) float a1[numLanes] {};
+        alignas(32) float a2[numLanes] {};
+        alignas(32) float a3[numLanes] {};
+        auto updateFilterGains = [&]()
+        {
+            for (int l = 0; l < numLanes; ++l)
+            {
+                a1[l] = 1.0f / (1.0f + filterG[l] * (filterG[l] + filterK[l]));
+                a2[l] = filterG[l] * a1[l];
+                a3[l] = filterG[l] * a2[l];
+            }
+        };
+
+        if (!filterRamping)
+            updateFilterGains();
+
+        for (int c = 0; c < chunkSamples; ++c)
+        {
+            // FM (as Voice::renderSample): the modulator runs first and
+            // advances, the carrier is offset by its own fmDepth
+            if (fm)
+            {
+                if (carrier == 0)
+                {
+                    laneOscillator(wave2, osc2Warp, osc2PulseWidth, osc2s, osc2Phase, osc2Inc, osc2InvInc, zeroOffset, mod);
+                    laneAdvance(osc2Phase, osc2Inc);
+                }
+                else
+                {
+                    laneOscillator(wave1, osc1Warp, osc1PulseWidth, osc1s, osc1Phase, osc1Inc, osc1InvInc, zeroOffset, mod);
+                    laneAdvance(osc1Phase, osc1Inc);
+                }
+
+                for (int l = 0; l < numLanes; ++l)
+                    fmOffset[l] = carrierDepth * (mod[l] * modDepth);
+            }
+
+            const bool fm1 = fm && carrier == 0;
+            const bool fm2 = fm && carrier == 1;
+
+            if (stereo1)
+            {
+                for (int l = 0; l < numLanes; ++l)
+                {
+                    o1[l] = o1Right[l] = 0.0f;
+                    if (l < numVoices)
+                        voices[l]->osc1Unison.processStereoSample(*osc1s[l], fm1 ? fmOffset[l] : 0.0f, o1[l], o1Right[l]);
+                }
+            }
+            else if (unison1)
+            {
+                for (int l = 0; l < numLanes; ++l)
+                    o1[l] = (l < numVoices) ? voices[l]->osc1Unison.processSample(*osc1s[l], fm1 ? fmOffset[l] : 0.0f)
+                                            : 0.0f;
+            }
+            else
+            {
+                laneOscillator(wave1, osc1Warp, osc1PulseWidth, osc1s, osc1Phase, osc1Inc, osc1InvInc, fm1 ? fmOffset : zeroOffset, o1);
+                laneAdvance(osc1Phase, osc1Inc);
+            }
+
+            if (stereo2)
+            {
+                for (int l = 0; l < numLanes; ++l)
+                {
+                    o2[l] = o2Right[l] = 0.0f;
+                    if (l < numVoices)
+                        voices[l]->osc2Unison.processStereoSample(*osc2s[l], fm2 ? fmOffset[l] : 0.0f, o2[l], o2Right[l]);
+                }
+            }
+            else if (unison2)
+            {
+                for (int l = 0; l < numLanes; ++l)
+                    o2[l] = (l < numVoices) ? voices[l]->osc2Unison.processSample(*osc2s[l], fm2 ? fmOffset[l] : 0.0f)
+                                            : 0.0f;
+            }
+            else
+            {
+                laneOscillator(wave2, osc2Warp, osc2PulseWidth, osc2s, osc2Phase, osc2Inc, osc2InvInc, fm2 ? fmOffset : zeroOffset, o2);
+                laneAdvance(osc2Phase, osc2Inc);
+            }
+
+            // a mono oscillator in a stereo group sits in the centre
+            if (stereo)
+            {
+                if (!stereo1)
+                    std::copy(o1, o1 + numLanes, o1Right);
+                if (!stereo2)
+                    std::copy(o2, o2 + numLanes, o2Right);
+            }
+
+            if (modulated)
+            {
+                for (int g = 0; g < Voice::numModGains; ++g)
+                    for (int l = 0; l < numLanes; ++l)
+                        modGain[g][l] += modGainStep[g][l];
+
+                for (int l = 0; l < numLanes; ++l)
+                {
+                    gain1[l] = std::max(0.0f, osc1Level + modGain[Voice::modOsc1Gain][l]);
+                    gain2[l] = std::max(0.0f, osc2Level + modGain[Voice::modOsc2Gain][l]);
+                    gainSub[l] = subOscLevel * std::max(0.0f, subLevel + modGain[Voice::modSubGain][l]);
+                    gainNoise[l] = std::max(0.0f, noiseLevel + modGain[Voice::modNoiseGain][l]);
+                }
+            }
+
+            for (int l = 0; l < numLanes; ++l)
+                y[l] = o1[l] * gain1[l] + o2[l] * gain2[l];
+            if (stereo)
+                for (int l = 0; l < numLanes; ++l)
+                    yRight[l] = o1Right[l] * gain1[l] + o2Right[l] * gain2[l];
+
+            // sub and noise sit in the centre
+            if (subEnabled)
+            {
+                for (int l = 0; l < numLanes; ++l)
+                    y[l] += ((subPhase[l] < 0.5f) ? gainSub[l] : -gainSub[l]);
+                if (stereo)
+                    for (int l = 0; l < numLanes; ++l)
+                        yRight[l] += ((subPhase[l] < 0.5f) ? gainSub[l] : -gainSub[l]);
+                laneAdvance(subPhase, subInc);
+            }
+
+            if (noiseOn)
+            {
+                alignas(32) float noise[numLanes];
+                for (int l = 0; l < numLanes; ++l)
+                {
+                    std::uint32_t r = noiseState[l];
+                    r ^= r << 13; r ^= r >> 17; r ^= r << 5;
+                    noiseState[l] = r;
+                    noise[l] = (static_cast<float>(r >> 8) * (2.0f / 16777216.0f) - 1.0f) * gainNoise[l];
+                    y[l] += noise[l];
+                }
+                if (stereo)
+                    for (int l = 0; l < numLanes; ++l)
+                        yRight[l] += noise[l];
+            }
+
+            // SVF (SVFFilter::processSample), all lanes
+            if (filterRamping)
+            {
+                const bool last = (c == chunkSamples - 1);
+                for (int l = 0; l < numLanes; ++l)
+                    filterG[l] = last ? filterGTarget[l] : filterG[l] * filterGRatio[l];
+                updateFilterGains();
+            }
+
+            auto filterLanes = [&](float* x, float* ic1, float* ic2)
+            {
+                for (int l = 0; l < numLanes; ++l)
+                {
+                    const float v3 = x[l] - ic2[l];
+                    const float v1 = a1[l] * ic1[l] + a2[l] * v3;
+                    const float v2 = ic2[l] + a2[l] * ic1[l] + a3[l] * v3;
+                    ic1[l] = 2.0f * v1 - ic1[l];
+                    ic2[l] = 2.0f * v2 - ic2[l];
+
+                    const float lowpass = v2;
+                    const float bandpass = v1;
+                    const float highpass = x[l] - filterK[l] * v1 - v2;
+                    const float notch = x[l] - filterK[l] * v1;
+
+                    x[l] = (filterType == FilterType::HIGHPASS) ? highpass
+                         : (filterType == FilterType::BANDPASS) ? bandpass
+                         : (filterType == FilterType::NOTCH) ? notch
+                         : lowpass;
+                }
+            };
+
+            filterLanes(y, filterIc1, filterIc2);
+
+            // amp envelope scales
+            float sum = 0.0f;
+            for (int l = 0; l < numLanes; ++l)
+                sum += y[l] * ampEnvelope[l][c];
+
+            float sumRight = sum;
+            if (stereo)
+            {
+                filterLanes(yRight, filterIc1Right, filterIc2Right);
+
+                sumRight = 0.0f;
+                for (int l = 0; l < numLanes; ++l)
+                    sumRight += yRight[l] * ampEnvelope[l][c];
+            }
+
+            if (right != nullptr)
+            {
+                left[chunkStart + c] += sum;
+                right[chunkStart + c] += sumRight;
+            }
+            else
+            {
+                left[chunkStart + c] += 0.5f * (sum + sumRight);
+            }
+        }
+
+        // mono voices keep their right integrators in step (SVFFilter::processSample)
+        if (!stereo)
+        {
+            std::copy(filterIc1, filterIc1 + numLanes, filterIc1Right);
+            std::copy(filterIc2, filterIc2 + numLanes, filterIc2Right);
+        }
+
+        // the ramp is complete: the filters continue from their targets
+        if (filterRamping)
+        {
+            for (int l = 0; l < numVoices; ++l)
+            {
+                SVFFilter& f = voices[l]->filter;
+                f.g = f.gTarget;
+                f.gRatio = 1.0f;
+                f.rampSamples = 0;
+                f.updateGains();
+            }
+        }
     }
 }
 
-int VoiceManager::getActiveVoiceCount() const
+//==============================================================================
+// VOICE MANAGER IMPLEMENTATION
+//==============================================================================
+
+VoiceManager::VoiceManager()
+    : monoVoiceIndex_(-1)
+    , glideEnabled_(false)
+    , glideTime_(0.1f)
+    , currentSampleRate_(48000.0)
 {
-    int count = 0;
-    for (const auto& voice : voices_)
+    noteToVoice_.fill(-1);
+}
+
+void VoiceManager::setPolyphony(int numVoices)
+{
+    requestedPolyphony_ = std::clamp(numVoices, 1, maxPolyphony);
+}
+
+void VoiceManager::prepare(double sampleRate, int samplesPerBlock)
+{
+    currentSampleRate_ = sampleRate;
+
+    // Everything the audio thread touches is sized here
+    const auto numVoices = static_cast<size_t>(requestedPolyphony_);
+
+    if (voices_.size() != numVoices)
     {
-        if (voice.isActive() || voice.ampEnv.isActive())
-            count++;
+        voices_.assign(numVoices, Voice());
+        laneGroups_.resize((numVoices + VoiceLaneGroup::numLanes - 1) / VoiceLaneGroup::numLanes);
+        laneScratch_.assign(numVoices, nullptr);
+        freeList_.assign(numVoices, -1);
+        activeList_.assign(numVoices, -1);
+        activeSlot_.assign(numVoices, -1);
+        queueNext_.assign(numVoices, -1);
+        queuePrev_.assign(numVoices, -1);
+        queueOf_.assign(numVoices, notQueued);
+    }
+
+    for (auto& voice : voices_)
+    {
+        voice.prepare(sampleRate);
+
+        // distinct noise sequence per voice, for the lane renderer and for the
+        // scalar generator (assign() copied one engine into every voice)
+        voice.laneNoiseState = 0x9E3779B9u + 0x632BE5ABu * static_cast<std::uint32_t>(indexOf(&voice));
+        voice.noiseGen.setSeed(voice.laneNoiseState);
+
+        // Initialize modMatrix pointer for each voice
+        // Note: This is a temporary fix - ideally the Voice structure
+        // should be refactored to store a reference or index to the modMatrix
+        // rather than a raw pointer that needs to be manually set
+    }
+
+    reset();
+}
+
+void VoiceManager::reset()
+{
+    for (auto& voice : voices_)
+    {
+        voice.reset();
+    }
+    monoVoiceIndex_ = -1;
+
+    // All voices free; popped from the back, so voice 0 is handed out first
+    const int numVoices = static_cast<int>(voices_.size());
+    for (int i = 0; i < numVoices; ++i)
+    {
+        freeList_[static_cast<size_t>(i)] = numVoices - 1 - i;
+        activeSlot_[static_cast<size_t>(i)] = -1;
+        queueNext_[static_cast<size_t>(i)] = -1;
+        queuePrev_[static_cast<size_t>(i)] = -1;
+        queueOf_[static_cast<size_t>(i)] = notQueued;
+    }
+    numFree_ = numVoices;
+    numActive_ = 0;
+
+    noteToVoice_.fill(-1);
+    queueHead_[heldQueue] = queueHead_[releasedQueue] = -1;
+    queueTail_[heldQueue] = queueTail_[releasedQueue] = -1;
+    sampleClock_ = 0;
+}
+
+void VoiceManager::queueAppend(int queue, int index)
+{
+    const auto i = static_cast<size_t>(index);
+    queueOf_[i] = queue;
+    queuePrev_[i] = queueTail_[queue];
+    queueNext_[i] = -1;
+
+    if (queueTail_[queue] >= 0)
+        queueNext_[static_cast<size_t>(queueTail_[queue])] = index;
+    else
+        queueHead_[queue] = index;
+
+    queueTail_[queue] = index;
+}
+
+void VoiceManager::queueRemove(int index)
+{
+    const auto i = static_cast<size_t>(index);
+    const int queue = queueOf_[i];
+    if (queue == notQueued)
+        return;
+
+    const int prev = queuePrev_[i];
+    const int next = queueNext_[i];
+
+    if (prev >= 0)
+        queueNext_[static_cast<size_t>(prev)] = next;
+    else
+        queueHead_[queue] = next;
+
+    if (next >= 0)
+        queuePrev_[static_cast<size_t>(next)] = prev;
+    else
+        queueTail_[queue] = prev;
+
+    queuePrev_[i] = queueNext_[i] = -1;
+    queueOf_[i] = notQueued;
+}
+
+Voice* VoiceManager::findFreeVoice()
+{
+    // Idle voice from the free list
+    if (numFree_ > 0)
+        return &voices_[static_cast<size_t>(freeList_[static_cast<size_t>(numFree_ - 1)])];
+
+    // Voice stealing: oldest released voice, else oldest held voice
+    const int oldest = (queueHead_[releasedQueue] >= 0) ? queueHead_[releasedQueue]
+                                                        : queueHead_[heldQueue];
+
+    return (oldest >= 0) ? &voices_[static_cast<size_t>(oldest)] : nullptr;
+}
+
+Voice* VoiceManager::findVoiceForNote(int note)
+{
+    if (note < 0 || note >= static_cast<int>(noteToVoice_.size()))
+        return nullptr;
+
+    const int index = noteToVoice_[static_cast<size_t>(note)];
+    return (index >= 0) ? &voices_[static_cast<size_t>(index)] : nullptr;
+}
+
+Voice* VoiceManager::startVoice(int note, float velocity)
+{
+    // A key struck again while held releases its previous voice
+    if (Voice* held = findVoiceForNote(note))
+        releaseVoice(indexOf(held));
+
+    Voice* voice = findFreeVoice();
+    if (!voice)
+        return nullptr;
+
+    const int index = indexOf(voice);
+    const auto i = static_cast<size_t>(index);
+
+    if (activeSlot_[i] < 0)
+    {
+        // from the free list (always its top entry) into the active list
+        --numFree_;
+        activeSlot_[i] = numActive_;
+        activeList_[static_cast<size_t>(numActive_++)] = index;
+    }
+    else
+    {
+        // stolen: drop its key mapping and its place in the steal order
+        if (voice->active && noteToVoice_[static_cast<size_t>(voice->midiNote)] == index)
+            noteToVoice_[static_cast<size_t>(voice->midiNote)] = -1;
+        queueRemove(index);
+    }
+
+    voice->noteOn(note, velocity, currentSampleRate_);
+    voice->startTime = static_cast<double>(sampleClock_) / currentSampleRate_;
+
+    noteToVoice_[static_cast<size_t>(note)] = index;
+    queueAppend(heldQueue, index);
+    return voice;
+}
+
+void VoiceManager::releaseVoice(int index)
+{
+    Voice& voice = voices_[static_cast<size_t>(index)];
+
+    if (voice.active && noteToVoice_[static_cast<size_t>(voice.midiNote)] == index)
+        noteToVoice_[static_cast<size_t>(voice.midiNote)] = -1;
+
+    voice.noteOff(0.0f);
+
+    // released voices are stolen first, oldest release first
+    if (queueOf_[static_cast<size_t>(index)] == heldQueue)
+    {
+        queueRemove(index);
+        queueAppend(releasedQueue, index);
+    }
+}
+
+void VoiceManager::retireFinishedVoices()
+{
+    // swap-remove voices whose envelopes have finished
+    for (int slot = 0; slot < numActive_;)
+    {
+        const int index = activeList_[static_cast<size_t>(slot)];
+        if (voices_[static_cast<size_t>(index)].isActive())
+        {
+            ++slot;
+            continue;
+        }
+
+        const int last = activeList_[static_cast<size_t>(--numActive_)];
+        activeList_[static_cast<size_t>(slot)] = last;
+        activeSlot_[static_cast<size_t>(last)] = slot;
+        activeSlot_[static_cast<size_t>(index)] = -1;
+
+        queueRemove(index);
+        freeList_[static_cast<size_t>(numFree_++)] = index;
+
+        if (index == monoVoiceIndex_)
+            monoVoiceIndex_ = -1;
+    }
+}
+
+void VoiceManager::handleNoteOn(int note, float velocity)
+{
+    if (note < 0 || note >= static_cast<int>(noteToVoice_.size()))
+        return;
+
+    if (polyMode_ == PolyphonyMode::MONO || polyMode_ == PolyphonyMode::LEGATO)
+    {
+        // Monophonic/legato mode
+        if (monoVoiceIndex_ == -1)
+        {
+            Voice* voice = startVoice(note, velocity);
+            if (voice)
+            {
+                monoVoiceIndex_ = indexOf(voice);
+            }
+        }
+        else
+        {
+            Voice& voice = voices_[static_cast<size_t>(monoVoiceIndex_)];
+
+            if (voice.active && noteToVoice_[static_cast<size_t>(voice.midiNote)] == monoVoiceIndex_)
+                noteToVoice_[static_cast<size_t>(voice.midiNote)] = -1;
+
+            if (polyMode_ == PolyphonyMode::LEGATO && voice.active)
+            {
+                // Legato: change pitch without retriggering envelopes
+                voice.midiNote = note;
+                float freq = static_cast<float>(midiToFrequency(note, 0.0));
+                voice.osc1.setFrequency(freq, currentSampleRate_);
+                voice.osc2.setFrequency(freq, currentSampleRate_);
+                voice.subOsc.setFrequency(freq, currentSampleRate_);
+            }
+            else
+            {
+                // Mono: retrigger
+                voice.noteOn(note, velocity, currentSampleRate_);
+                voice.startTime = static_cast<double>(sampleClock_) / currentSampleRate_;
+            }
+
+            noteToVoice_[static_cast<size_t>(note)] = monoVoiceIndex_;
+            queueRemove(monoVoiceIndex_);
+            queueAppend(heldQueue, monoVoiceIndex_);
+        }
+    }
+    else
+    {
+        // Polyphonic
+        startVoice(note, velocity);
+    }
+}
+
+void VoiceManager::handleNoteOff(int note)
+{
+    if (Voice* voice = findVoiceForNote(note))
+    {
+        releaseVoice(indexOf(voice));
+    }
+}
+
+void VoiceManager::allNotesOff()
+{
+    for (int slot = 0; slot < numActive_; ++slot)
+    {
+        releaseVoice(activeList_[static_cast<size_t>(slot)]);
+    }
+}
+
+void VoiceManager::processBlock(float* output, int numSamples, double sampleRate, float* outputRight)
+{
+    if (renderPath_ == VoiceRenderPath::Lanes)
+        processBlockLanes(output, outputRight, numSamples);
+    else
+        processBlockScalar(output, outputRight, numSamples);
+
+    retireFinishedVoices();
+    sampleClock_ += numSamples;
+}
+
+void VoiceManager::processBlockLanes(float* left, float* right, int numSamples)
+{
+    std::fill(left, left + numSamples, 0.0f);
+    if (right != nullptr)
+        std::fill(right, right + numSamples, 0.0f);
+
+    // the active list is already compact: hand it to the lane groups in order
+    for (int slot = 0; slot < numActive_; ++slot)
+        laneScratch_[static_cast<size_t>(slot)] = &voices_[static_cast<size_t>(activeList_[static_cast<size_t>(slot)])];
+
+    for (int g = 0; g * VoiceLaneGroup::numLanes < numActive_; ++g)
+    {
+        auto& group = laneGroups_[static_cast<size_t>(g)];
+        const int first = g * VoiceLaneGroup::numLanes;
+
+        group.gather(laneScratch_.data() + first, std::min(VoiceLaneGroup::numLanes, numActive_ - first));
+        group.render(left, right, numSamples);
+        group.scatter();
+    }
+}
+
+void VoiceManager::processBlockScalar(float* left, float* right, int numSamples)
+{
+    // Render all active voices, with a filter modulation ramp per chunk
+    for (int chunkStart = 0; chunkStart < numSamples; chunkStart += Voice::filterModulationChunk)
+    {
+        const int chunkSamples = std::min(Voice::filterModulationChunk, numSamples - chunkStart);
+
+        for (int slot = 0; slot < numActive_; ++slot)
+            voices_[static_cast<size_t>(activeList_[static_cast<size_t>(slot)])].updateFilterModulation(chunkSamples);
+
+        for (int i = chunkStart; i < chunkStart + chunkSamples; ++i)
+        {
+            float mix = 0.0f;
+            float mixRight = 0.0f;
+
+            for (int slot = 0; slot < numActive_; ++slot)
+            {
+                float voiceLeft, voiceRight;
+                voices_[static_cast<size_t>(activeList_[static_cast<size_t>(slot)])].renderSample(voiceLeft, voiceRight);
+                mix += voiceLeft;
+                mixRight += voiceRight;
+            }
+
+            if (right != nullptr)
+            {
+                left[i] = mix;
+                right[i] = mixRight;
+            }
+            else
+            {
+                left[i] = 0.5f * (mix + mixRight);
+            }
+        }
     }
-    return count;
 }
 
 void VoiceManager::updateVoiceParameters(const MotionPureDSP& synth)
 {
     for (auto& voice : voices_)
     {
-        // Update oscillator levels
-        voice.osc1Level = synth.params_.osc1Level;
-        voice.osc2Level = synth.params_.osc2Level;
-        voice.subLevel = synth.params_.subLevel;
-        voice.noiseLevel = synth.params_.noiseLevel;
-
-        // Update FM synthesis parameters
-        voice.fmEnabled = synth.params_.fmEnabled != 0.0f;
-        voice.fmDepth = synth.params_.fmDepth;
-        voice.fmCarrierIndex = static_cast<int>(synth.params_.fmCarrierOsc);
-
-        // Update filter envelope amount
-        voice.filterEnvelopeAmount = synth.params_.filterEnvAmount;
-
-        // Update oscillator waveforms
-        voice.osc1.setWaveform(static_cast<int>(synth.params_.osc1Shape));
-        voice.osc2.setWaveform(static_cast<int>(synth.params_.osc2Shape));
-
-        // Update oscillator warp
-        voice.osc1.setWarp(synth.params_.osc1Warp);
-        voice.osc2.setWarp(synth.params_.osc2Warp);
-
-        // Update oscillator pulse width
-        voice.osc1.setPulseWidth(synth.params_.osc1PulseWidth);
-        voice.osc2.setPulseWidth(synth.params_.osc2PulseWidth);
-
-        // Update sub oscillator enable and level
-        voice.subOsc.setEnabled(synth.params_.subEnabled != 0.0f);
-        voice.subOsc.setLevel(synth.params_.subLevel);
-        voice.subLevel = synth.params_.subLevel;
-
-        // Update noise level
-        voice.noiseGen.setLevel(synth.params_.noiseLevel);
-
-        // Update filter parameters
-        voice.filter.setType(static_cast<FilterType>(static_cast<int>(synth.params_.filterType)));
-        voice.filter.setCutoff(synth.params_.filterCutoff * 20000.0f); // Normalize to Hz
-        voice.filter.setResonance(synth.params_.filterResonance);
-
-        // Update filter envelope
-        Envelope::Parameters filterEnvParams;
-        filterEnvParams.attack = synth.params_.filterEnvAttack;
-        filterEnvParams.decay = synth.params_.filterEnvDecay;
-        filterEnvParams.sustain = synth.params_.filterEnvSustain;
-        filterEnvParams.release = synth.params_.filterEnvRelease;
-        voice.filterEnv.setParameters(filterEnvParams);
-
-        // Update amp envelope
-        Envelope::Parameters ampEnvParams;
-        ampEnvParams.attack = synth.params_.ampEnvAttack;
-        ampEnvParams.decay = synth.params_.ampEnvDecay;
-        ampEnvParams.sustain = synth.params_.ampEnvSustain;
-        ampEnvParams.release = synth.params_.ampEnvRelease;
-        voice.ampEnv.setParameters(ampEnvParams);
+        for (int g = 1; g < static_cast<int>(VoiceParameterGroup::NumGroups); ++g)
+            updateVoiceGroup(voice, synth, static_cast<VoiceParameterGroup>(g));
 
         // Update LFOs (if modMatrix pointer is set)
         // Note: The modMatrix pointer is currently null in Voice structure
@@ -1104,26 +2684,222 @@ void VoiceManager::updateVoiceParameters(const MotionPureDSP& synth)
     }
 }
 
+void VoiceManager::updateVoiceParameter(const MotionPureDSP& synth, int paramIndex)
+{
+    const auto group = groupOfParameter(paramIndex);
+    if (group == VoiceParameterGroup::None)
+        return;
+
+    for (auto& voice : voices_)
+        updateVoiceGroup(voice, synth, group);
+}
+
+VoiceManager::VoiceParameterGroup VoiceManager::groupOfParameter(int paramIndex)
+{
+    using Parameters = MotionPureDSP::Parameters;
+    const std::size_t offset = MotionPureDSP::parameterRegistry[paramIndex].offset;
+
+    auto is = [offset](std::initializer_list<std::size_t> fields) {
+        return std::find(fields.begin(), fields.end(), offset) != fields.end();
+    };
+
+    if (is({ offsetof(Parameters, osc1Level), offsetof(Parameters, osc2Level), offsetof(Parameters, subEnabled),
+             offsetof(Parameters, subLevel), offsetof(Parameters, noiseLevel) }))
+        return VoiceParameterGroup::Mix;
+    if (is({ offsetof(Parameters, fmEnabled), offsetof(Parameters, fmDepth), offsetof(Parameters, fmCarrierOsc) }))
+        return VoiceParameterGroup::FM;
+    if (is({ offsetof(Parameters, filterEnvAmount), offsetof(Parameters, filterKeyTrack), offsetof(Parameters, filterVelTrack) }))
+        return VoiceParameterGroup::FilterTracking;
+    if (is({ offsetof(Parameters, oscEngine) }))
+        return VoiceParameterGroup::Engine;
+    if (is({ offsetof(Parameters, osc1Shape), offsetof(Parameters, osc2Shape) }))
+        return VoiceParameterGroup::Waveform;
+    if (is({ offsetof(Parameters, osc1Warp), offsetof(Parameters, osc2Warp) }))
+        return VoiceParameterGroup::Warp;
+    if (is({ offsetof(Parameters, osc1PulseWidth), offsetof(Parameters, osc2PulseWidth) }))
+        return VoiceParameterGroup::PulseWidth;
+    if (is({ offsetof(Parameters, osc1UnisonVoices), offsetof(Parameters, osc1UnisonDetune), offsetof(Parameters, osc1UnisonSpread),
+             offsetof(Parameters, osc2UnisonVoices), offsetof(Parameters, osc2UnisonDetune), offsetof(Parameters, osc2UnisonSpread) }))
+        return VoiceParameterGroup::Unison;
+    if (is({ offsetof(Parameters, filterType), offsetof(Parameters, filterCutoff), offsetof(Parameters, filterResonance) }))
+        return VoiceParameterGroup::Filter;
+    if (is({ offsetof(Parameters, filterEnvAttack), offsetof(Parameters, filterEnvDecay),
+             offsetof(Parameters, filterEnvSustain), offsetof(Parameters, filterEnvRelease) }))
+        return VoiceParameterGroup::FilterEnvelope;
+    if (is({ offsetof(Parameters, ampEnvAttack), offsetof(Parameters, ampEnvDecay),
+             offsetof(Parameters, ampEnvSustain), offsetof(Parameters, ampEnvRelease) }))
+        return VoiceParameterGroup::AmpEnvelope;
+
+    return VoiceParameterGroup::None;
+}
+
+void VoiceManager::updateVoiceGroup(Voice& voice, const MotionPureDSP& synth, VoiceParameterGroup group)
+{
+    const auto& params = synth.modulatedParams_;
+
+    switch (group)
+    {
+        case VoiceParameterGroup::Mix:
+            // Oscillator, sub and noise levels
+            voice.osc1Level = params.osc1Level;
+            voice.osc2Level = params.osc2Level;
+            voice.subOsc.setEnabled(params.subEnabled != 0.0f);
+            voice.subOsc.setLevel(params.subLevel);
+            voice.subLevel = params.subLevel;
+            voice.noiseGen.setLevel(params.noiseLevel);
+            voice.noiseLevel = params.noiseLevel;
+            break;
+
+        case VoiceParameterGroup::FM:
+            voice.fmEnabled = params.fmEnabled != 0.0f;
+            voice.fmDepth = params.fmDepth;
+            voice.fmCarrierIndex = static_cast<int>(params.fmCarrierOsc);
+            break;
+
+        case VoiceParameterGroup::FilterTracking:
+            // Filter envelope amount and tracking
+            voice.filterEnvelopeAmount = params.filterEnvAmount;
+            voice.filterKeyTrack = params.filterKeyTrack;
+            voice.filterVelocityTrack = params.filterVelTrack;
+            break;
+
+        case VoiceParameterGroup::Engine:
+        {
+            const auto engine = (params.oscEngine >= 0.5f) ? OscillatorEngine::WAVETABLE
+                                                           : OscillatorEngine::POLYBLEP;
+            voice.osc1.setEngine(engine);
+            voice.osc2.setEngine(engine);
+            break;
+        }
+
+        case VoiceParameterGroup::Waveform:
+            voice.osc1.setWaveform(static_cast<int>(params.osc1Shape));
+            voice.osc2.setWaveform(static_cast<int>(params.osc2Shape));
+            break;
+
+        case VoiceParameterGroup::Warp:
+            voice.osc1.setWarp(params.osc1Warp);
+            voice.osc2.setWarp(params.osc2Warp);
+            break;
+
+        case VoiceParameterGroup::PulseWidth:
+            voice.osc1.setPulseWidth(params.osc1PulseWidth);
+            voice.osc2.setPulseWidth(params.osc2PulseWidth);
+            break;
+
+        case VoiceParameterGroup::Unison:
+            voice.osc1Unison.setVoices(static_cast<int>(params.osc1UnisonVoices), params.osc1UnisonDetune, params.osc1UnisonSpread);
+            voice.osc2Unison.setVoices(static_cast<int>(params.osc2UnisonVoices), params.osc2UnisonDetune, params.osc2UnisonSpread);
+            break;
+
+        case VoiceParameterGroup::Filter:
+            voice.filter.setType(static_cast<FilterType>(static_cast<int>(params.filterType)));
+            voice.filter.setCutoff(params.filterCutoff * 20000.0f); // Normalize to Hz
+            voice.filter.setResonance(params.filterResonance);
+            break;
+
+        case VoiceParameterGroup::FilterEnvelope:
+        {
+            Envelope::Parameters filterEnvParams;
+            filterEnvParams.attack = params.filterEnvAttack;
+            filterEnvParams.decay = params.filterEnvDecay;
+            filterEnvParams.sustain = params.filterEnvSustain;
+            filterEnvParams.release = params.filterEnvRelease;
+            voice.filterEnv.setParameters(filterEnvParams);
+            break;
+        }
+
+        case VoiceParameterGroup::AmpEnvelope:
+        {
+            Envelope::Parameters ampEnvParams;
+            ampEnvParams.attack = params.ampEnvAttack;
+            ampEnvParams.decay = params.ampEnvDecay;
+            ampEnvParams.sustain = params.ampEnvSustain;
+            ampEnvParams.release = params.ampEnvRelease;
+            voice.ampEnv.setParameters(ampEnvParams);
+            break;
+        }
+
+        case VoiceParameterGroup::None:
+        case VoiceParameterGroup::NumGroups:
+            break;
+    }
+}
+
+void VoiceManager::applyModulation(const MotionPureDSP& synth, const ModulationMatrix& matrix, int numSamples)
+{
+    const int numRoutes = matrix.getNumRoutes();
+
+    // Empty matrix: nothing to do, once the last offsets have been cleared
+    if (numRoutes == 0 && !modulationActive_)
+        return;
+
+    // Destination ranges at amount 1
+    constexpr float pitchRangeSemitones = 12.0f;
+    constexpr float cutoffRangeOctaves = 5.0f;
+
+    const auto& params = synth.modulatedParams_;
+    const float baseCutoff = params.filterCutoff * 20000.0f;
+    const float invSamples = 1.0f / static_cast<float>(std::max(1, numSamples));
+
+    float sources[numModSources];
+    std::copy(matrix.sourceValues, matrix.sourceValues + numModSources, sources);
+
+    float destinations[numModDestinations];
+
+    auto dest = [&destinations](ModDestination d) { return destinations[static_cast<int>(d)]; };
+
+    for (int slot = 0; slot < numActive_; ++slot)
+    {
+        Voice& voice = voices_[static_cast<size_t>(activeList_[static_cast<size_t>(slot)])];
+
+        sources[static_cast<int>(ModSource::VELOCITY)] = voice.velocity;
+        sources[static_cast<int>(ModSource::FILTER_ENV)] = voice.filterEnv.getLevel();
+        sources[static_cast<int>(ModSource::AMP_ENV)] = voice.ampEnv.getLevel();
+
+        matrix.evaluate(sources, destinations);
+
+        // Stepped once per control block
+        const float noteFreq = static_cast<float>(midiToFrequency(voice.midiNote, 0.0));
+        voice.osc1.setFrequency(noteFreq * std::exp2(dest(ModDestination::OSC1_FREQ) * pitchRangeSemitones / 12.0f), currentSampleRate_);
+        voice.osc2.setFrequency(noteFreq * std::exp2(dest(ModDestination::OSC2_FREQ) * pitchRangeSemitones / 12.0f), currentSampleRate_);
+        voice.osc1.setWarp(params.osc1Warp + dest(ModDestination::OSC1_WARP));
+        voice.osc2.setWarp(params.osc2Warp + dest(ModDestination::OSC2_WARP));
+        voice.osc1.setPulseWidth(params.osc1PulseWidth + dest(ModDestination::OSC1_PULSE_WIDTH));
+        voice.osc2.setPulseWidth(params.osc2PulseWidth + dest(ModDestination::OSC2_PULSE_WIDTH));
+        voice.filter.setCutoff(baseCutoff * std::exp2(dest(ModDestination::FILTER_CUTOFF) * cutoffRangeOctaves));
+        voice.filter.setResonance(params.filterResonance + dest(ModDestination::FILTER_RESONANCE));
+
+        // Ramped across the block
+        const float gainTargets[Voice::numModGains] = {
+            dest(ModDestination::OSC1_LEVEL), dest(ModDestination::OSC2_LEVEL),
+            dest(ModDestination::SUB_LEVEL), dest(ModDestination::NOISE_LEVEL)
+        };
+
+        for (int g = 0; g < Voice::numModGains; ++g)
+        {
+            if (numRoutes == 0)
+                voice.modGain[g] = voice.modGainStep[g] = 0.0f;
+            else
+                voice.modGainStep[g] = (gainTargets[g] - voice.modGain[g]) * invSamples;
+        }
+
+        voice.modulated = numRoutes > 0;
+    }
+
+    modulationActive_ = numRoutes > 0;
+}
+
 //==============================================================================
 // MAIN MOTION MARCO PURE DSP IMPLEMENTATION
 //==============================================================================
 
 MotionPureDSP::MotionPureDSP()
 {
-    // Initialize with default preset values to ensure silence is not due to zero parameters
-    params_.osc1Level = 0.7f;
-    params_.osc2Level = 0.6f;
-    params_.subLevel = 0.4f;
-    params_.subEnabled = 1.0f;
-    params_.masterVolume = 0.85f;
-    params_.osc1Shape = 0.0f;  // Saw
-    params_.osc2Shape = 1.0f;  // Square
-    params_.ampEnvAttack = 0.01f;
-    params_.ampEnvDecay = 0.3f;
-    params_.ampEnvSustain = 0.7f;
-    params_.ampEnvRelease = 0.4f;
-    params_.filterCutoff = 0.5f;
-    params_.filterResonance = 0.7f;
+    // Start from the init patch in the parameter table, so silence is never
+    // down to zeroed parameters
+    parameterRegistry.resetToDefaults(params_);
+    modulatedParams_ = params_;
 }
 
 MotionPureDSP::~MotionPureDSP()
@@ -1135,12 +2911,19 @@ bool MotionPureDSP::prepare(double sampleRate, int blockSize)
     sampleRate_ = sampleRate;
     blockSize_ = blockSize;
 
+    // Build the shared wavetables here, not on the audio thread when a
+    // preset first selects the wavetable engine
+    WavetableBank::getInstance();
+
     voiceManager_.prepare(sampleRate, blockSize);
     modMatrix_.prepare(sampleRate);
 
+    // Not processing until the next process(): writes land directly again
+    audioThread_.store(std::thread::id(), std::memory_order_relaxed);
+
     // CRITICAL: Apply current parameters to all voices after preparation
     // This ensures voices have proper oscillator levels and envelope settings
-    voiceManager_.updateVoiceParameters(*this);
+    applyParameters();
 
     return true;
 }
@@ -1150,34 +2933,97 @@ void MotionPureDSP::reset()
     voiceManager_.reset();
     modMatrix_.reset();
     pitchBend_ = 0.0;
+
+    // Automation ramps jump to their targets
+    if (numActiveRamps_ > 0)
+        advanceParameterRamps(std::numeric_limits<int>::max());
 }
 
 void MotionPureDSP::process(float** outputs, int numChannels, int numSamples)
 {
+    audioThread_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
     // Clear output buffers
     for (int ch = 0; ch < numChannels; ++ch)
     {
         std::memset(outputs[ch], 0, sizeof(float) * numSamples);
     }
 
-    // Update modulation sources (LFOs, envelopes)
-    for (int i = 0; i < numSamples; ++i)
+    // Automation queued since the last call, in sample order
+    drainParameterEvents();
+    int nextEvent = 0;
+
+    // Hosts may send any block size: render in sub-blocks that fit the
+    // real-time safe member buffer
+    for (int start = 0; start < numSamples; start += MAX_BLOCK_SIZE)
     {
-        modMatrix_.processModulationSources();
-    }
+        const int blockSamples = std::min(MAX_BLOCK_SIZE, numSamples - start);
+
+        // Global modulation sources for this block
+        modMatrix_.sourceValues[static_cast<int>(ModSource::PITCH_WHEEL)] = static_cast<float>(pitchBend_);
+        for (int m = 0; m < 8; ++m)
+            modMatrix_.sourceValues[static_cast<int>(ModSource::MACRO_1) + m] = macros_.getMacroValue(m);
+
+        // Render all active voices in control blocks. Matrix routes are
+        // evaluated at the start of each one and automation ramps step at
+        // its end, so a block renders the values of its first sample; an
+        // automation event always starts a new one.
+        for (int c = 0; c < blockSamples;)
+        {
+            const int position = start + c;
 
-    // Render all active voices
-    float tempBuffer[512];
-    voiceManager_.processBlock(tempBuffer, numSamples, sampleRate_);
+            while (nextEvent < numPendingEvents_ && pendingEvents_[nextEvent].sampleOffset <= position)
+                startParameterChange(pendingEvents_[nextEvent++]);
 
-    // Process stereo output
-    for (int i = 0; i < numSamples; ++i)
-    {
-        float sample = tempBuffer[i] * params_.masterVolume;
-        processStereoSample(outputs[0][i], outputs[1][i]);
-        outputs[0][i] = sample;
-        outputs[1][i] = sample;
+            // Preset values and mod slot writes: one rebuild for the lot
+            if (rebuildPending_)
+            {
+                rebuildPending_ = false;
+                applyParameters();
+            }
+
+            int controlSamples = blockSamples - c;
+            if (modMatrix_.getNumRoutes() > 0 || numActiveRamps_ > 0)
+                controlSamples = std::min(controlSamples, controlRate_);
+            if (nextEvent < numPendingEvents_)
+                controlSamples = std::min(controlSamples, pendingEvents_[nextEvent].sampleOffset - position);
+
+            modMatrix_.advanceSources(controlSamples);
+            voiceManager_.applyModulation(*this, modMatrix_, controlSamples);
+            voiceManager_.processBlock(tempBuffer_ + c, controlSamples, sampleRate_, tempBufferRight_ + c);
+
+            // Master volume per control block, so its automation lands on time too
+            const float gain = modulatedParams_.masterVolume;
+            for (int i = c; i < c + controlSamples; ++i)
+            {
+                tempBuffer_[i] *= gain;
+                tempBufferRight_[i] *= gain;
+            }
+
+            if (numActiveRamps_ > 0)
+                advanceParameterRamps(controlSamples);
+
+            c += controlSamples;
+        }
+
+        // Left and right to the first two channels; a mono output and any
+        // further channels get the mid signal
+        const int firstMidChannel = (numChannels >= 2) ? 2 : 0;
+        for (int i = 0; i < blockSamples; ++i)
+        {
+            if (numChannels >= 2)
+            {
+                outputs[0][start + i] = tempBuffer_[i];
+                outputs[1][start + i] = tempBufferRight_[i];
+            }
+
+            const float mid = 0.5f * (tempBuffer_[i] + tempBufferRight_[i]);
+            for (int ch = firstMidChannel; ch < numChannels; ++ch)
+                outputs[ch][start + i] = mid;
+        }
     }
+
+    retireParameterEvents(nextEvent, numSamples);
 }
 
 void MotionPureDSP::handleEvent(const ScheduledEvent& event)
@@ -1196,6 +3042,10 @@ void MotionPureDSP::handleEvent(const ScheduledEvent& event)
             pitchBend_ = event.data.pitchBend.bendValue;
             break;
 
+        case ScheduledEvent::CHANNEL_PRESSURE:
+            modMatrix_.sourceValues[static_cast<int>(ModSource::AFTERTOUCH)] = event.data.channelPressure.pressure;
+            break;
+
         default:
             break;
     }
@@ -1203,126 +3053,321 @@ void MotionPureDSP::handleEvent(const ScheduledEvent& event)
 
 float MotionPureDSP::getParameter(const char* paramId) const
 {
-    // OSC1
-    if (std::strcmp(paramId, "osc1_shape") == 0) return params_.osc1Shape;
-    if (std::strcmp(paramId, "osc1_warp") == 0) return params_.osc1Warp;
-    if (std::strcmp(paramId, "osc1_pulse_width") == 0) return params_.osc1PulseWidth;
-    if (std::strcmp(paramId, "osc1_detune") == 0) return params_.osc1Detune;
-    if (std::strcmp(paramId, "osc1_level") == 0) return params_.osc1Level;
-
-    // OSC2
-    if (std::strcmp(paramId, "osc2_shape") == 0) return params_.osc2Shape;
-    if (std::strcmp(paramId, "osc2_warp") == 0) return params_.osc2Warp;
-    if (std::strcmp(paramId, "osc2_pulse_width") == 0) return params_.osc2PulseWidth;
-    if (std::strcmp(paramId, "osc2_detune") == 0) return params_.osc2Detune;
-    if (std::strcmp(paramId, "osc2_level") == 0) return params_.osc2Level;
-
-    // Sub
-    if (std::strcmp(paramId, "sub_enabled") == 0) return params_.subEnabled;
-    if (std::strcmp(paramId, "sub_level") == 0) return params_.subLevel;
-
-    // FM
-    if (std::strcmp(paramId, "fm_enabled") == 0) return params_.fmEnabled;
-    if (std::strcmp(paramId, "fm_depth") == 0) return params_.fmDepth;
-
-    // Filter
-    if (std::strcmp(paramId, "filter_type") == 0) return params_.filterType;
-    if (std::strcmp(paramId, "filter_cutoff") == 0) return params_.filterCutoff;
-    if (std::strcmp(paramId, "filter_resonance") == 0) return params_.filterResonance;
-
-    // Envelopes
-    if (std::strcmp(paramId, "filter_env_attack") == 0) return params_.filterEnvAttack;
-    if (std::strcmp(paramId, "filter_env_decay") == 0) return params_.filterEnvDecay;
-    if (std::strcmp(paramId, "filter_env_sustain") == 0) return params_.filterEnvSustain;
-    if (std::strcmp(paramId, "filter_env_release") == 0) return params_.filterEnvRelease;
-    if (std::strcmp(paramId, "filter_env_amount") == 0) return params_.filterEnvAmount;
-
-    if (std::strcmp(paramId, "amp_env_attack") == 0) return params_.ampEnvAttack;
-    if (std::strcmp(paramId, "amp_env_decay") == 0) return params_.ampEnvDecay;
-    if (std::strcmp(paramId, "amp_env_sustain") == 0) return params_.ampEnvSustain;
-    if (std::strcmp(paramId, "amp_env_release") == 0) return params_.ampEnvRelease;
-
-    // LFOs
-    if (std::strcmp(paramId, "lfo1_rate") == 0) return params_.lfo1Rate;
-    if (std::strcmp(paramId, "lfo1_depth") == 0) return params_.lfo1Depth;
-
-    if (std::strcmp(paramId, "lfo2_rate") == 0) return params_.lfo2Rate;
-    if (std::strcmp(paramId, "lfo2_depth") == 0) return params_.lfo2Depth;
-
-    // Global
-    if (std::strcmp(paramId, "master_volume") == 0) return params_.masterVolume;
-    if (std::strcmp(paramId, "poly_mode") == 0) return params_.polyMode;
+    const int index = parameterRegistry.indexOf(paramId);
+    if (index >= 0)
+        return parameterRegistry.get(params_, index);
+
+    // Modulation matrix slots
+    const int field = modSlotRegistry.indexOf(paramId);
+    if (field >= 0)
+        return modSlotRegistry.get(params_, field);
 
     return 0.0f;
 }
 
 void MotionPureDSP::setParameter(const char* paramId, float value)
 {
+    int index = parameterRegistry.indexOf(paramId);
+    if (index < 0)
+    {
+        // Modulation matrix slots: mod_<slot>_<source|destination|amount|bipolar|curve>
+        const int field = modSlotRegistry.indexOf(paramId);
+        if (field < 0)
+            return;
+        index = parameterRegistry.size + field;
+    }
+
+    if (!onAudioThread())
+    {
+        ParameterEvent event;
+        event.index = index;
+        event.value = value;
+        event.type = ParameterEventType::Set;
+        controlEvents_.push(event);
+        return;
+    }
+
+    if (index < parameterRegistry.size)
+    {
+        setParameterValue(index, value);
+        return;
+    }
+
+    const int field = index - parameterRegistry.size;
+    const float oldValue = modSlotRegistry.get(params_, field);
+    modSlotRegistry.set(params_, field, value);
+    LOG_PARAMETER_CHANGE("Motion", paramId, oldValue, value);
+    applyParameters();
+}
+
+float MotionPureDSP::getParameterValue(int index) const
+{
+    if (index < 0 || index >= parameterRegistry.size)
+        return 0.0f;
+
+    return parameterRegistry.get(params_, index);
+}
+
+void MotionPureDSP::setParameterValue(int index, float value)
+{
+    if (index < 0 || index >= parameterRegistry.size)
+        return;
+
+    cancelParameterRamp(index);
+
     // Get old value for logging (before change)
-    float oldValue = getParameter(paramId);
-
-    // OSC1
-    if (std::strcmp(paramId, "osc1_shape") == 0) params_.osc1Shape = value;
-    if (std::strcmp(paramId, "osc1_warp") == 0) params_.osc1Warp = value;
-    if (std::strcmp(paramId, "osc1_pulse_width") == 0) params_.osc1PulseWidth = value;
-    if (std::strcmp(paramId, "osc1_detune") == 0) params_.osc1Detune = value;
-    if (std::strcmp(paramId, "osc1_level") == 0) params_.osc1Level = value;
-
-    // OSC2
-    if (std::strcmp(paramId, "osc2_shape") == 0) params_.osc2Shape = value;
-    if (std::strcmp(paramId, "osc2_warp") == 0) params_.osc2Warp = value;
-    if (std::strcmp(paramId, "osc2_pulse_width") == 0) params_.osc2PulseWidth = value;
-    if (std::strcmp(paramId, "osc2_detune") == 0) params_.osc2Detune = value;
-    if (std::strcmp(paramId, "osc2_level") == 0) params_.osc2Level = value;
-
-    // Sub
-    if (std::strcmp(paramId, "sub_enabled") == 0) params_.subEnabled = value;
-    if (std::strcmp(paramId, "sub_level") == 0) params_.subLevel = value;
-
-    // FM
-    if (std::strcmp(paramId, "fm_enabled") == 0) params_.fmEnabled = value;
-    if (std::strcmp(paramId, "fm_depth") == 0) params_.fmDepth = value;
-
-    // Filter
-    if (std::strcmp(paramId, "filter_type") == 0) params_.filterType = value;
-    if (std::strcmp(paramId, "filter_cutoff") == 0) params_.filterCutoff = value;
-    if (std::strcmp(paramId, "filter_resonance") == 0) params_.filterResonance = value;
-
-    // Envelopes
-    if (std::strcmp(paramId, "filter_env_attack") == 0) params_.filterEnvAttack = value;
-    if (std::strcmp(paramId, "filter_env_decay") == 0) params_.filterEnvDecay = value;
-    if (std::strcmp(paramId, "filter_env_sustain") == 0) params_.filterEnvSustain = value;
-    if (std::strcmp(paramId, "filter_env_release") == 0) params_.filterEnvRelease = value;
-    if (std::strcmp(paramId, "filter_env_amount") == 0) params_.filterEnvAmount = value;
-
-    if (std::strcmp(paramId, "amp_env_attack") == 0) params_.ampEnvAttack = value;
-    if (std::strcmp(paramId, "amp_env_decay") == 0) params_.ampEnvDecay = value;
-    if (std::strcmp(paramId, "amp_env_sustain") == 0) params_.ampEnvSustain = value;
-    if (std::strcmp(paramId, "amp_env_release") == 0) params_.ampEnvRelease = value;
-
-    // LFOs
-    if (std::strcmp(paramId, "lfo1_rate") == 0) params_.lfo1Rate = value;
-    if (std::strcmp(paramId, "lfo1_depth") == 0) params_.lfo1Depth = value;
-
-    if (std::strcmp(paramId, "lfo2_rate") == 0) params_.lfo2Rate = value;
-    if (std::strcmp(paramId, "lfo2_depth") == 0) params_.lfo2Depth = value;
-
-    // Global
-    if (std::strcmp(paramId, "master_volume") == 0) params_.masterVolume = value;
-    if (std::strcmp(paramId, "poly_mode") == 0) params_.polyMode = value;
+    const float oldValue = parameterRegistry.get(params_, index);
+    parameterRegistry.set(params_, index, value);
 
     // Log parameter change (shared telemetry infrastructure)
-    LOG_PARAMETER_CHANGE("Motion", paramId, oldValue, value);
+    LOG_PARAMETER_CHANGE("Motion", parameterRegistry[index].id, oldValue, value);
 
-    applyParameters();
+    applyParameterChange(index);
+}
+
+void MotionPureDSP::writeParameter(int index, float value)
+{
+    if (index < parameterRegistry.size)
+        parameterRegistry.set(params_, index, value);
+    else
+        modSlotRegistry.set(params_, index - parameterRegistry.size, value);
+}
+
+bool MotionPureDSP::onAudioThread() const
+{
+    const std::thread::id audioThread = audioThread_.load(std::memory_order_relaxed);
+    return audioThread == std::thread::id() || audioThread == std::this_thread::get_id();
+}
+
+bool MotionPureDSP::scheduleParameterChange(int index, float value, int sampleOffset)
+{
+    if (index < 0 || index >= parameterRegistry.size)
+        return false;
+
+    ParameterEvent event;
+    event.index = index;
+    event.value = value;
+    event.sampleOffset = std::max(0, sampleOffset);
+    return parameterEvents_.push(event);
+}
+
+void MotionPureDSP::drainParameterEvents()
+{
+    const int numSorted = numPendingEvents_;
+    ParameterEvent event;
+    while (numPendingEvents_ < maxParameterEvents && parameterEvents_.pop(event))
+        pendingEvents_[numPendingEvents_++] = event;
+    while (numPendingEvents_ < maxParameterEvents && controlEvents_.pop(event))
+        pendingEvents_[numPendingEvents_++] = event;
+
+    if (numPendingEvents_ == numSorted)
+        return;
+
+    // Producers push in offset order, so the new events are usually one
+    // sorted run after the pending one: merge neighbouring runs until a
+    // single run is left. std::merge is stable, so events with equal
+    // offsets keep their queue order.
+    const auto byOffset = [](const ParameterEvent& a, const ParameterEvent& b)
+    {
+        return a.sampleOffset < b.sampleOffset;
+    };
+
+    ParameterEvent* source = pendingEvents_;
+    ParameterEvent* const end = pendingEvents_ + numPendingEvents_;
+    if (std::is_sorted(source, end, byOffset))
+        return;
+
+    ParameterEvent* target = mergeScratch_;
+    for (int numRuns = 0; numRuns != 1;)
+    {
+        numRuns = 0;
+        const int count = numPendingEvents_;
+        for (int begin = 0; begin < count; ++numRuns)
+        {
+            const int middle = static_cast<int>(std::is_sorted_until(source + begin, source + count, byOffset) - source);
+            const int runEnd = static_cast<int>(std::is_sorted_until(source + middle, source + count, byOffset) - source);
+            std::merge(source + begin, source + middle, source + middle, source + runEnd, target + begin, byOffset);
+            begin = runEnd;
+        }
+        std::swap(source, target);
+    }
+
+    if (source != pendingEvents_)
+        std::copy(source, source + numPendingEvents_, pendingEvents_);
+}
+
+void MotionPureDSP::retireParameterEvents(int numApplied, int numSamples)
+{
+    // Whatever is left lands in a later call
+    int remaining = 0;
+    for (int i = numApplied; i < numPendingEvents_; ++i)
+    {
+        pendingEvents_[remaining] = pendingEvents_[i];
+        pendingEvents_[remaining].sampleOffset -= numSamples;
+        ++remaining;
+    }
+    numPendingEvents_ = remaining;
+}
+
+void MotionPureDSP::startParameterChange(const ParameterEvent& event)
+{
+    const int index = event.index;
+
+    // Mod slot fields have no ramps; the matrix is rebuilt after the events
+    if (index >= parameterRegistry.size)
+    {
+        writeParameter(index, event.value);
+        rebuildPending_ = true;
+        return;
+    }
+
+    const auto& descriptor = parameterRegistry[index];
+    const float target = std::max(descriptor.minValue, std::min(descriptor.maxValue, event.value));
+    const int rampSamples = (parameterSmoothing_ && event.type == ParameterEventType::Ramp)
+                                ? static_cast<int>(descriptor.smoothingSeconds * sampleRate_) : 0;
+
+    if (rampSamples <= 0)
+    {
+        cancelParameterRamp(index);
+        parameterRegistry.set(params_, index, target);
+        if (event.type == ParameterEventType::Load)
+            rebuildPending_ = true;
+        else
+            applyParameterChange(index);
+        return;
+    }
+
+    if (rampRemaining_[index] == 0)
+        ++numActiveRamps_;
+
+    rampTarget_[index] = target;
+    rampRemaining_[index] = rampSamples;
+    rampStep_[index] = (target - parameterRegistry.get(params_, index)) / static_cast<float>(rampSamples);
+}
+
+void MotionPureDSP::advanceParameterRamps(int numSamples)
+{
+    for (int index = 0; index < parameterRegistry.size && numActiveRamps_ > 0; ++index)
+    {
+        if (rampRemaining_[index] == 0)
+            continue;
+
+        const int steps = std::min(numSamples, rampRemaining_[index]);
+        rampRemaining_[index] -= steps;
+
+        if (rampRemaining_[index] > 0)
+        {
+            parameterRegistry.set(params_, index, parameterRegistry.get(params_, index) + rampStep_[index] * static_cast<float>(steps));
+        }
+        else
+        {
+            parameterRegistry.set(params_, index, rampTarget_[index]);
+            --numActiveRamps_;
+        }
+
+        applyParameterChange(index);
+    }
+}
+
+void MotionPureDSP::cancelParameterRamp(int index)
+{
+    if (rampRemaining_[index] > 0)
+    {
+        rampRemaining_[index] = 0;
+        --numActiveRamps_;
+    }
 }
 
 void MotionPureDSP::applyParameters()
 {
+    // Macro knobs, then their offsets on top of the base values
+    for (int m = 0; m < MacroSystem::numMacros; ++m)
+        macros_.setMacroValue(m, params_.macroValue[m]);
+
+    modulatedParams_ = params_;
+
+    int macroTargets[MacroSystem::maxRoutes];
+    float macroOffsets[MacroSystem::maxRoutes];
+    const int numMacroTargets = macros_.evaluate(macroTargets, macroOffsets);
+    for (int t = 0; t < numMacroTargets; ++t)
+        parameterRegistry.set(modulatedParams_, macroTargets[t], parameterRegistry.get(params_, macroTargets[t]) + macroOffsets[t]);
+
+    applyLfoParameters();
+
+    // Modulation matrix slots, compiled once into the active route list
+    for (int i = 0; i < 16; ++i)
+    {
+        auto& slot = modMatrix_.slots[static_cast<size_t>(i)];
+        slot.source = static_cast<ModSource>(std::max(0, std::min(numModSources - 1, static_cast<int>(params_.modSource[i]))));
+        slot.destination = static_cast<ModDestination>(std::max(0, std::min(numModDestinations - 1, static_cast<int>(params_.modDestination[i]))));
+        slot.amount.store(params_.modAmount[i]);
+        slot.bipolar = params_.modBipolar[i] != 0.0f;
+        slot.curveType = static_cast<int>(params_.modCurve[i]);
+    }
+    modMatrix_.compile();
+
     // Update all voices with current synth parameters
     voiceManager_.updateVoiceParameters(*this);
 }
 
+void MotionPureDSP::applyParameterChange(int index)
+{
+    const std::size_t offset = parameterRegistry[index].offset;
+    const std::size_t macroBase = offsetof(Parameters, macroValue);
+
+    if (offset < macroBase || offset >= macroBase + sizeof(Parameters::macroValue))
+    {
+        applyModulatedParameter(index);
+        return;
+    }
+
+    // A macro knob: the compiled routes stay, only its destinations move
+    const int m = static_cast<int>((offset - macroBase) / sizeof(float));
+    macros_.setMacroValue(m, params_.macroValue[m]);
+    modulatedParams_.macroValue[m] = params_.macroValue[m];
+
+    int destinations[MacroSystem::maxDestinations];
+    const int numDestinations = macros_.getDestinations(m, destinations);
+    for (int d = 0; d < numDestinations; ++d)
+        applyModulatedParameter(destinations[d]);
+}
+
+void MotionPureDSP::applyModulatedParameter(int index)
+{
+    parameterRegistry.set(modulatedParams_, index,
+                          parameterRegistry.get(params_, index) + macros_.getModulation(index));
+
+    const std::size_t offset = parameterRegistry[index].offset;
+    if (offset >= offsetof(Parameters, lfo1Waveform) && offset <= offsetof(Parameters, lfo2Bipolar))
+        applyLfoParameters();
+
+    voiceManager_.updateVoiceParameter(*this, index);
+}
+
+void MotionPureDSP::applyLfoParameters()
+{
+    modMatrix_.lfo1.setWaveform(static_cast<LFOWaveform>(std::max(0, std::min(4, static_cast<int>(modulatedParams_.lfo1Waveform)))));
+    modMatrix_.lfo1.setRate(modulatedParams_.lfo1Rate, sampleRate_);
+    modMatrix_.lfo1.setDepth(modulatedParams_.lfo1Depth);
+    modMatrix_.lfo1.setBipolar(modulatedParams_.lfo1Bipolar != 0.0f);
+    modMatrix_.lfo2.setWaveform(static_cast<LFOWaveform>(std::max(0, std::min(4, static_cast<int>(modulatedParams_.lfo2Waveform)))));
+    modMatrix_.lfo2.setRate(modulatedParams_.lfo2Rate, sampleRate_);
+    modMatrix_.lfo2.setDepth(modulatedParams_.lfo2Depth);
+    modMatrix_.lfo2.setBipolar(modulatedParams_.lfo2Bipolar != 0.0f);
+}
+
+void MotionPureDSP::addMacroDestination(int macroIndex, const char* paramId, float amount, float minVal, float maxVal)
+{
+    macros_.addDestination(macroIndex, getParameterIndex(paramId), amount, minVal, maxVal);
+    applyParameters();
+}
+
+void MotionPureDSP::clearMacroDestinations(int macroIndex)
+{
+    macros_.clearDestinations(macroIndex);
+    applyParameters();
+}
+
 int MotionPureDSP::getActiveVoiceCount() const
 {
     return voiceManager_.getActiveVoiceCount();
@@ -1335,12 +3380,6 @@ float MotionPureDSP::calculateFrequency(int midiNote, float bend) const
     return static_cast<float>(midiToFrequency(static_cast<int>(adjustedNote), 0.0));
 }
 
-void MotionPureDSP::processStereoSample(float& left, float& right)
-{
-    // Stereo processing (currently mono)
-    // Pan could be applied here
-}
-
 bool MotionPureDSP::savePreset(char* jsonBuffer, int jsonBufferSize) const
 {
     int offset = 0;
@@ -1351,28 +3390,12 @@ bool MotionPureDSP::savePreset(char* jsonBuffer, int jsonBufferSize) const
         return false;
     offset += written;
 
-    // OSC1 parameters
-    writeJsonParameter("osc1_shape", params_.osc1Shape, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("osc1_warp", params_.osc1Warp, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("osc1_level", params_.osc1Level, jsonBuffer, offset, jsonBufferSize);
-
-    // OSC2 parameters
-    writeJsonParameter("osc2_shape", params_.osc2Shape, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("osc2_warp", params_.osc2Warp, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("osc2_level", params_.osc2Level, jsonBuffer, offset, jsonBufferSize);
-
-    // Filter parameters
-    writeJsonParameter("filter_cutoff", params_.filterCutoff, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("filter_resonance", params_.filterResonance, jsonBuffer, offset, jsonBufferSize);
-
-    // Envelope parameters
-    writeJsonParameter("amp_env_attack", params_.ampEnvAttack, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("amp_env_decay", params_.ampEnvDecay, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("amp_env_sustain", params_.ampEnvSustain, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("amp_env_release", params_.ampEnvRelease, jsonBuffer, offset, jsonBufferSize);
-
-    // Master volume
-    writeJsonParameter("master_volume", params_.masterVolume, jsonBuffer, offset, jsonBufferSize);
+    // Every parameter in the table
+    for (int i = 0; i < parameterRegistry.size; ++i)
+    {
+        if (!writeJsonParameter(parameterRegistry[i].id, parameterRegistry.get(params_, i), jsonBuffer, offset, jsonBufferSize))
+            return false;
+    }
 
     // Remove trailing comma and add closing brace
     if (offset > 1 && jsonBuffer[offset - 1] == ',')
@@ -1414,196 +3437,77 @@ bool MotionPureDSP::loadPreset(const char* jsonData)
 
 bool MotionPureDSP::loadUPFSPreset(const UPFS::Preset& preset)
 {
-    // Map UPFS parameters to DSP parameters
-    // Parameters are stored in a flat map in the preset
-
-    // OSC1 parameters
-    if (auto param = preset.getParameter("osc1_shape"))
-        params_.osc1Shape = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("osc1_warp"))
-        params_.osc1Warp = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("osc1_pulse_width"))
-        params_.osc1PulseWidth = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("osc1_detune"))
-        params_.osc1Detune = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("osc1_pan"))
-        params_.osc1Pan = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("osc1_level"))
-        params_.osc1Level = static_cast<float>(param->value);
-
-    // OSC2 parameters
-    if (auto param = preset.getParameter("osc2_shape"))
-        params_.osc2Shape = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("osc2_warp"))
-        params_.osc2Warp = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("osc2_pulse_width"))
-        params_.osc2PulseWidth = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("osc2_detune"))
-        params_.osc2Detune = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("osc2_pan"))
-        params_.osc2Pan = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("osc2_level"))
-        params_.osc2Level = static_cast<float>(param->value);
-
-    // Sub oscillator
-    if (auto param = preset.getParameter("sub_enabled"))
-        params_.subEnabled = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("sub_level"))
-        params_.subLevel = static_cast<float>(param->value);
-
-    // Noise
-    if (auto param = preset.getParameter("noise_level"))
-        params_.noiseLevel = static_cast<float>(param->value);
+    ParameterEvent values[parameterRegistry.size + numModSlotFields];
+    int numValues = 0;
 
-    // FM synthesis
-    if (auto param = preset.getParameter("fm_enabled"))
-        params_.fmEnabled = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("fm_carrier_osc"))
-        params_.fmCarrierOsc = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("fm_mode"))
-        params_.fmMode = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("fm_depth"))
-        params_.fmDepth = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("fm_modulator_ratio"))
-        params_.fmModulatorRatio = static_cast<float>(param->value);
-
-    // Filter
-    if (auto param = preset.getParameter("filter_type"))
-        params_.filterType = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("filter_cutoff"))
-        params_.filterCutoff = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("filter_resonance"))
-        params_.filterResonance = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("filter_key_track"))
-        params_.filterKeyTrack = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("filter_vel_track"))
-        params_.filterVelTrack = static_cast<float>(param->value);
-
-    // Filter envelope
-    if (auto param = preset.getParameter("filter_env_attack"))
-        params_.filterEnvAttack = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("filter_env_decay"))
-        params_.filterEnvDecay = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("filter_env_sustain"))
-        params_.filterEnvSustain = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("filter_env_release"))
-        params_.filterEnvRelease = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("filter_env_amount"))
-        params_.filterEnvAmount = static_cast<float>(param->value);
-
-    // Amp envelope
-    if (auto param = preset.getParameter("amp_env_attack"))
-        params_.ampEnvAttack = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("amp_env_decay"))
-        params_.ampEnvDecay = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("amp_env_sustain"))
-        params_.ampEnvSustain = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("amp_env_release"))
-        params_.ampEnvRelease = static_cast<float>(param->value);
-
-    // LFO1
-    if (auto param = preset.getParameter("lfo1_waveform"))
-        params_.lfo1Waveform = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("lfo1_rate"))
-        params_.lfo1Rate = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("lfo1_depth"))
-        params_.lfo1Depth = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("lfo1_bipolar"))
-        params_.lfo1Bipolar = static_cast<float>(param->value);
-
-    // LFO2
-    if (auto param = preset.getParameter("lfo2_waveform"))
-        params_.lfo2Waveform = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("lfo2_rate"))
-        params_.lfo2Rate = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("lfo2_depth"))
-        params_.lfo2Depth = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("lfo2_bipolar"))
-        params_.lfo2Bipolar = static_cast<float>(param->value);
-
-    // Modulation matrix (16 slots)
-    for (int i = 0; i < 16; ++i)
+    // Map UPFS parameters to DSP parameters
+    // Parameters are stored in a flat map in the preset, under the same ids
+    for (int i = 0; i < parameterRegistry.size; ++i)
     {
-        std::string prefix = "mod_" + std::to_string(i) + "_";
-        if (auto param = preset.getParameter(prefix + "source"))
-            params_.modSource[i] = static_cast<float>(param->value);
-        if (auto param = preset.getParameter(prefix + "destination"))
-            params_.modDestination[i] = static_cast<float>(param->value);
-        if (auto param = preset.getParameter(prefix + "amount"))
-            params_.modAmount[i] = static_cast<float>(param->value);
-        if (auto param = preset.getParameter(prefix + "bipolar"))
-            params_.modBipolar[i] = static_cast<float>(param->value);
-        if (auto param = preset.getParameter(prefix + "curve"))
-            params_.modCurve[i] = static_cast<float>(param->value);
+        if (auto param = preset.getParameter(parameterRegistry[i].id))
+        {
+            values[numValues].index = i;
+            values[numValues++].value = static_cast<float>(param->value);
+        }
     }
 
-    // Macros (8 macros)
-    for (int i = 0; i < 8; ++i)
+    // Modulation matrix slots, from the generated id table
+    for (int i = 0; i < modSlotRegistry.size; ++i)
     {
-        std::string macroName = "macro_" + std::to_string(i) + "_value";
-        if (auto param = preset.getParameter(macroName))
-            params_.macroValue[i] = static_cast<float>(param->value);
+        if (auto param = preset.getParameter(modSlotRegistry[i].id))
+        {
+            values[numValues].index = parameterRegistry.size + i;
+            values[numValues++].value = static_cast<float>(param->value);
+        }
     }
 
-    // Global parameters
-    if (auto param = preset.getParameter("poly_mode"))
-        params_.polyMode = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("glide_enabled"))
-        params_.glideEnabled = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("glide_time"))
-        params_.glideTime = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("master_tune"))
-        params_.masterTune = static_cast<float>(param->value);
-    if (auto param = preset.getParameter("master_volume"))
-        params_.masterVolume = static_cast<float>(param->value);
-
-    applyParameters();
-    return true;
+    return applyPresetValues(values, numValues);
 }
 
 bool MotionPureDSP::loadLegacyPreset(const char* jsonData)
 {
+    ParameterEvent values[parameterRegistry.size];
+    int numValues = 0;
+
     // Simplified JSON parsing for legacy format
     double value;
 
-    if (parseJsonParameter(jsonData, "osc1_shape", value))
-        params_.osc1Shape = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "osc1_warp", value))
-        params_.osc1Warp = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "osc1_level", value))
-        params_.osc1Level = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "osc2_shape", value))
-        params_.osc2Shape = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "osc2_warp", value))
-        params_.osc2Warp = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "osc2_level", value))
-        params_.osc2Level = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "filter_cutoff", value))
-        params_.filterCutoff = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "filter_resonance", value))
-        params_.filterResonance = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "amp_env_attack", value))
-        params_.ampEnvAttack = static_cast<float>(value);
+    for (int i = 0; i < parameterRegistry.size; ++i)
+    {
+        if (parseJsonParameter(jsonData, parameterRegistry[i].id, value))
+        {
+            values[numValues].index = i;
+            values[numValues++].value = static_cast<float>(value);
+        }
+    }
 
-    if (parseJsonParameter(jsonData, "amp_env_decay", value))
-        params_.ampEnvDecay = static_cast<float>(value);
+    return applyPresetValues(values, numValues);
+}
 
-    if (parseJsonParameter(jsonData, "amp_env_sustain", value))
-        params_.ampEnvSustain = static_cast<float>(value);
+bool MotionPureDSP::applyPresetValues(const ParameterEvent* values, int numValues)
+{
+    if (!onAudioThread())
+    {
+        // All or nothing: a half-applied preset is worse than none
+        if (controlEvents_.capacity() - controlEvents_.size() < numValues)
+            return false;
 
-    if (parseJsonParameter(jsonData, "amp_env_release", value))
-        params_.ampEnvRelease = static_cast<float>(value);
+        for (int i = 0; i < numValues; ++i)
+        {
+            ParameterEvent event = values[i];
+            event.sampleOffset = 0;
+            event.type = ParameterEventType::Load;
+            controlEvents_.push(event);
+        }
+        return true;
+    }
 
-    if (parseJsonParameter(jsonData, "master_volume", value))
-        params_.masterVolume = static_cast<float>(value);
+    for (int i = 0; i < numValues; ++i)
+    {
+        if (values[i].index < parameterRegistry.size)
+            cancelParameterRamp(values[i].index);
+        writeParameter(values[i].index, values[i].value);
+    }
 
     applyParameters();
     return true;
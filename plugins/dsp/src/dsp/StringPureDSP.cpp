@@ -13,10 +13,10 @@
 
 #include "dsp/StringPureDSP.h"
 #include "../../../../include/dsp/DSPLogging.h"
+#include "../../../../include/dsp/FastMath.h"
 #include <cstring>
 #include <random>
 #include <algorithm>
-#include <cassert>
 
 namespace DSP {
 
@@ -236,13 +236,13 @@ float AetherStringModalFilter::processSample(float excitation)
     // Decay energy with NaN safety
     // Prevent division by zero: clamp decay to minimum value
     float safeDecay = std::max(0.001f, decay);
-    float decayFactor = std::exp(-1.0f / (safeDecay * safeSampleRate));
+    float decayFactor = SchillingerEcosystem::DSP::FastMath::exp(-1.0f / (safeDecay * safeSampleRate));
 
     // Clamp energy to prevent NaN/Inf explosion
     energy = energy * decayFactor + excitation * amplitude * 0.1f;
     energy = std::max(-100.0f, std::min(100.0f, energy));  // Safety clamp
 
-    float output = std::sin(phase) * energy * baseAmplitude;
+    float output = SchillingerEcosystem::DSP::FastMath::sin(phase) * energy * baseAmplitude;
 
     // Final NaN check - return 0.0f if NaN detected
     if (std::isnan(output) || std::isinf(output))
@@ -484,7 +484,7 @@ void AetherStringArticulationStateMachine::updateGain()
     // Prevent division by zero
     if (samples < 1.0f) samples = 1.0f;
 
-    float coef = std::exp(-1.0f / samples);
+    float coef = SchillingerEcosystem::DSP::FastMath::exp(-1.0f / samples);
 
     currentGain = currentGain * coef + targetGain * (1.0f - coef);
 
@@ -499,8 +499,8 @@ void AetherStringArticulationStateMachine::updateGain()
 float AetherStringArticulationStateMachine::crossfadeGain(float oldValue, float newValue, float progress)
 {
     // Equal-power crossfade
-    float oldGain = std::cos(progress * M_PI * 0.5f);
-    float newGain = std::sin(progress * M_PI * 0.5f);
+    float oldGain = SchillingerEcosystem::DSP::FastMath::cos2Pi(progress * 0.25f);
+    float newGain = SchillingerEcosystem::DSP::FastMath::sin2Pi(progress * 0.25f);
     return oldValue * oldGain + newValue * newGain;
 }
 
@@ -836,29 +836,33 @@ void StringPureDSP::process(float** outputs, int numChannels, int numSamples)
         std::fill(outputs[ch], outputs[ch] + numSamples, 0.0f);
     }
 
-    // Render mono using real-time safe stack buffer
-    // Assert for safety in debug builds - block size should never exceed MAX_BLOCK_SIZE
-    assert(numSamples <= MAX_BLOCK_SIZE && "Block size exceeds maximum buffer size");
-
-    voiceManager_.processBlock(tempBuffer_, numSamples);
-
-    // Apply master volume and copy to outputs with NaN safety
-    for (int i = 0; i < numSamples; ++i)
+    // Hosts may send any block size: render in sub-blocks that fit the
+    // real-time safe member buffer
+    for (int start = 0; start < numSamples; start += MAX_BLOCK_SIZE)
     {
-        float sample = tempBuffer_[i] * params_.masterVolume;
+        const int blockSamples = std::min(MAX_BLOCK_SIZE, numSamples - start);
+
+        // Render mono
+        voiceManager_.processBlock(tempBuffer_, blockSamples);
 
-        // Check for NaN/Inf in final output
-        if (std::isnan(sample) || std::isinf(sample))
+        // Apply master volume and copy to outputs with NaN safety
+        for (int i = 0; i < blockSamples; ++i)
         {
-            sample = 0.0f;
-        }
+            float sample = tempBuffer_[i] * params_.masterVolume;
 
-        // Clamp to reasonable range
-        sample = std::max(-1.0f, std::min(1.0f, sample));
+            // Check for NaN/Inf in final output
+            if (std::isnan(sample) || std::isinf(sample))
+            {
+                sample = 0.0f;
+            }
 
-        for (int ch = 0; ch < numChannels; ++ch)
-        {
-            outputs[ch][i] = sample;
+            // Clamp to reasonable range
+            sample = std::max(-1.0f, std::min(1.0f, sample));
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                outputs[ch][start + i] = sample;
+            }
         }
     }
 }
@@ -886,58 +890,33 @@ void StringPureDSP::handleEvent(const ScheduledEvent& event)
 
 float StringPureDSP::getParameter(const char* paramId) const
 {
-    if (std::strcmp(paramId, "master_volume") == 0)
-        return params_.masterVolume;
-    if (std::strcmp(paramId, "string_damping") == 0)
-        return params_.stringDamping;
-    if (std::strcmp(paramId, "string_stiffness") == 0)
-        return params_.stringStiffness;
-    if (std::strcmp(paramId, "string_brightness") == 0)
-        return params_.stringBrightness;
-    if (std::strcmp(paramId, "bridge_coupling") == 0)
-        return params_.bridgeCoupling;
-    if (std::strcmp(paramId, "body_resonance") == 0)
-        return params_.bodyResonance;
-    if (std::strcmp(paramId, "attack_time") == 0)
-        return params_.attackTime;
-    if (std::strcmp(paramId, "decay_time") == 0)
-        return params_.decayTime;
-    if (std::strcmp(paramId, "sustain_level") == 0)
-        return params_.sustainLevel;
-    if (std::strcmp(paramId, "release_time") == 0)
-        return params_.releaseTime;
-
-    return 0.0f;
+    return getParameterValue(parameterRegistry.indexOf(paramId));
 }
 
 void StringPureDSP::setParameter(const char* paramId, float value)
 {
+    setParameterValue(parameterRegistry.indexOf(paramId), value);
+}
+
+float StringPureDSP::getParameterValue(int index) const
+{
+    if (index < 0 || index >= parameterRegistry.size)
+        return 0.0f;
+
+    return parameterRegistry.get(params_, index);
+}
+
+void StringPureDSP::setParameterValue(int index, float value)
+{
+    if (index < 0 || index >= parameterRegistry.size)
+        return;
+
     // Get old value for logging (before change)
-    float oldValue = getParameter(paramId);
-
-    if (std::strcmp(paramId, "master_volume") == 0)
-        params_.masterVolume = value;
-    else if (std::strcmp(paramId, "string_damping") == 0)
-        params_.stringDamping = value;
-    else if (std::strcmp(paramId, "string_stiffness") == 0)
-        params_.stringStiffness = value;
-    else if (std::strcmp(paramId, "string_brightness") == 0)
-        params_.stringBrightness = value;
-    else if (std::strcmp(paramId, "bridge_coupling") == 0)
-        params_.bridgeCoupling = value;
-    else if (std::strcmp(paramId, "body_resonance") == 0)
-        params_.bodyResonance = value;
-    else if (std::strcmp(paramId, "attack_time") == 0)
-        params_.attackTime = value;
-    else if (std::strcmp(paramId, "decay_time") == 0)
-        params_.decayTime = value;
-    else if (std::strcmp(paramId, "sustain_level") == 0)
-        params_.sustainLevel = value;
-    else if (std::strcmp(paramId, "release_time") == 0)
-        params_.releaseTime = value;
+    const float oldValue = parameterRegistry.get(params_, index);
+    parameterRegistry.set(params_, index, value);
 
     // Log parameter change (shared telemetry infrastructure)
-    LOG_PARAMETER_CHANGE("MotionAetherString", paramId, oldValue, value);
+    LOG_PARAMETER_CHANGE("MotionAetherString", parameterRegistry[index].id, oldValue, value);
 
     applyParameters();
 }
@@ -952,12 +931,11 @@ bool StringPureDSP::savePreset(char* jsonBuffer, int jsonBufferSize) const
     std::snprintf(jsonBuffer + offset, remaining, "{");
     offset = 1;
 
-    writeJsonParameter("master_volume", params_.masterVolume, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("string_damping", params_.stringDamping, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("string_stiffness", params_.stringStiffness, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("string_brightness", params_.stringBrightness, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("bridge_coupling", params_.bridgeCoupling, jsonBuffer, offset, jsonBufferSize);
-    writeJsonParameter("body_resonance", params_.bodyResonance, jsonBuffer, offset, jsonBufferSize);
+    for (int i = 0; i < parameterRegistry.size; ++i)
+    {
+        if (!writeJsonParameter(parameterRegistry[i].id, parameterRegistry.get(params_, i), jsonBuffer, offset, jsonBufferSize))
+            return false;
+    }
 
     // Remove trailing comma and add closing brace
     if (offset > 1 && jsonBuffer[offset - 1] == ',')
@@ -993,23 +971,15 @@ bool StringPureDSP::loadUPFSPreset(const char* jsonData)
 {
     double value;
 
+    // Master volume is optional in UPFS
+    params_.masterVolume = 0.85f;
+
     // UPFS v1.0 format parameters
-    if (parseJsonParameter(jsonData, "string_damping", value))
-        params_.stringDamping = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "string_stiffness", value))
-        params_.stringStiffness = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "string_brightness", value))
-        params_.stringBrightness = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "bridge_coupling", value))
-        params_.bridgeCoupling = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "body_resonance", value))
-        params_.bodyResonance = static_cast<float>(value);
-
-    // Master volume (optional in UPFS, default if not present)
-    if (parseJsonParameter(jsonData, "master_volume", value))
-        params_.masterVolume = static_cast<float>(value);
-    else
-        params_.masterVolume = 0.85f; // Default value
+    for (int i = 0; i < parameterRegistry.size; ++i)
+    {
+        if (parseJsonParameter(jsonData, parameterRegistry[i].id, value))
+            parameterRegistry.set(params_, i, static_cast<float>(value));
+    }
 
     applyParameters();
 
@@ -1021,18 +991,11 @@ bool StringPureDSP::loadLegacyPreset(const char* jsonData)
     double value;
 
     // Legacy format parameters
-    if (parseJsonParameter(jsonData, "master_volume", value))
-        params_.masterVolume = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "string_damping", value))
-        params_.stringDamping = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "string_stiffness", value))
-        params_.stringStiffness = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "string_brightness", value))
-        params_.stringBrightness = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "bridge_coupling", value))
-        params_.bridgeCoupling = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "body_resonance", value))
-        params_.bodyResonance = static_cast<float>(value);
+    for (int i = 0; i < parameterRegistry.size; ++i)
+    {
+        if (parseJsonParameter(jsonData, parameterRegistry[i].id, value))
+            parameterRegistry.set(params_, i, static_cast<float>(value));
+    }
 
     applyParameters();
 
@@ -16,9 +16,13 @@
 #include <gtest/gtest.h>
 #include <juce_audio_basics/juce_audio_basics.h>
 #include "../../include/dsp/AetherDSP.h"
+#include "../../include/dsp/AetherPureDSP.h"
 #include <algorithm>
 #include <chrono>
 #include <array>
+#include <cmath>
+#include <iterator>
+#include <utility>
 #include <vector>
 
 //==============================================================================
@@ -938,6 +942,108 @@ TEST_F(MotionAetherTests, ResonatorBank_InharmonicModesUseGoldenRatio)
     std::cout << "Inharmonic modes verified: golden ratio spacing" << std::endl;
 }
 
+//==============================================================================
+// TEST: AetherPureDSP Host Block Sizes
+//==============================================================================
+
+// Four-note chord rendered through process() in host blocks of blockSize
+static void renderAetherPureDSP(int blockSize, std::vector<float>& left, std::vector<float>& right, int numSamples)
+{
+    DSP::AetherPureDSP synth;
+    synth.prepare(48000.0, 512);  // host announces 512, then sends other sizes
+    synth.setParameter("bodyPreset", 0.0f);  // pushes the body modes to the voices
+
+    DSP::ScheduledEvent event;
+    event.type = DSP::ScheduledEvent::NOTE_ON;
+    event.time = 0.0;
+    event.sampleOffset = 0;
+    event.data.note.velocity = 0.8f;
+    for (int note : { 48, 55, 60, 64 })
+    {
+        event.data.note.midiNote = note;
+        synth.handleEvent(event);
+    }
+
+    left.assign(numSamples, 0.0f);
+    right.assign(numSamples, 0.0f);
+
+    for (int start = 0; start < numSamples; start += blockSize)
+    {
+        float* outputs[2] = { left.data() + start, right.data() + start };
+        synth.process(outputs, 2, std::min(blockSize, numSamples - start));
+    }
+}
+
+TEST_F(MotionAetherTests, PureDSP_OutputIndependentOfHostBlockSize)
+{
+    const int numSamples = 32768;
+    std::vector<float> refLeft, refRight;
+    renderAetherPureDSP(32, refLeft, refRight, numSamples);
+
+    float peak = 0.0f;
+    for (float x : refLeft)
+        peak = std::max(peak, std::abs(x));
+
+    ASSERT_GT(peak, 0.001f) << "Reference render is silent";
+
+    for (int blockSize : { 1, 31, 512, 4096, 16384 })
+    {
+        std::vector<float> left, right;
+        renderAetherPureDSP(blockSize, left, right, numSamples);
+
+        bool finite = true;
+        float maxDiff = 0.0f;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            finite = finite && std::isfinite(left[i]) && std::isfinite(right[i]);
+            maxDiff = std::max({ maxDiff, std::abs(left[i] - refLeft[i]), std::abs(right[i] - refRight[i]) });
+        }
+
+        EXPECT_TRUE(finite) << "NaN/Inf at " << blockSize << "-sample blocks";
+        EXPECT_LE(maxDiff, peak * 1.0e-5f) << blockSize << "-sample blocks differ from the 32-sample render";
+    }
+}
+
+//==============================================================================
+// TEST: AetherPureDSP Parameter Registry
+//==============================================================================
+
+TEST_F(MotionAetherTests, PureDSP_ParameterIndexRoundTrip)
+{
+    DSP::AetherPureDSP synth;
+    synth.prepare(48000.0, 512);
+
+    // id and an in-range value that is not the default
+    const std::pair<const char*, float> params[] = {
+        { "masterVolume", 2.5f }, { "damping", 0.9f }, { "brightness", 0.25f },
+        { "stiffness", 0.375f }, { "bridgeCoupling", 0.5f }, { "nonlinearity", 0.75f },
+        { "dispersion", 0.125f }, { "sympatheticCoupling", 0.625f }, { "material", 1.5f },
+        { "bodyPreset", 2.0f },
+    };
+
+    ASSERT_EQ(synth.getNumParameters(), static_cast<int>(std::size(params)));
+    EXPECT_EQ(synth.getParameterIndex("noSuchParameter"), -1);
+
+    std::vector<bool> seen(static_cast<size_t>(synth.getNumParameters()), false);
+
+    for (const auto& [id, value] : params)
+    {
+        const int index = synth.getParameterIndex(id);
+        ASSERT_GE(index, 0) << id << " is not registered";
+        ASSERT_LT(index, synth.getNumParameters()) << id;
+        EXPECT_FALSE(seen[static_cast<size_t>(index)]) << id << " shares an index";
+        seen[static_cast<size_t>(index)] = true;
+
+        // index set -> id get
+        synth.setParameterValue(index, value);
+        EXPECT_FLOAT_EQ(synth.getParameter(id), value) << id;
+
+        // id set -> index get
+        synth.setParameter(id, 0.0f);
+        EXPECT_FLOAT_EQ(synth.getParameterValue(index), 0.0f) << id;
+    }
+}
+
 // Continue with the rest of the tests in Google Test format...
         //======================================================================
         // PHASE 1: CORE DSP COMPONENTS (Week 1)
@@ -17,13 +17,20 @@
 */
 
 #include "../../include/dsp/StringDSP.h"
+#include "../../include/dsp/StringPureDSP.h"
 #include "DSPTestFramework.h"
 #include <juce_core/juce_core.h>
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <string>
+#include <utility>
 #include <cassert>
+#include <vector>
 
 using namespace DSPTestFramework;
 
@@ -1311,6 +1318,106 @@ void test_Pedalboard_RealtimeSafety()
     TEST_ASSERT(true, "Pedalboard realtime-safe (no allocations or crashes)");
 }
 
+//==============================================================================
+// Category: StringPureDSP Host Block Sizes
+//==============================================================================
+
+// Four-note chord rendered through process() in host blocks of blockSize
+static void renderStringPureDSP(int blockSize, std::vector<float>& left, std::vector<float>& right, int numSamples)
+{
+    DSP::StringPureDSP synth;
+    synth.prepare(48000.0, 512);  // host announces 512, then sends other sizes
+
+    DSP::ScheduledEvent event;
+    event.type = DSP::ScheduledEvent::NOTE_ON;
+    event.time = 0.0;
+    event.sampleOffset = 0;
+    event.data.note.velocity = 0.8f;
+    for (int note : { 48, 55, 60, 64 })
+    {
+        event.data.note.midiNote = note;
+        synth.handleEvent(event);
+    }
+
+    left.assign(numSamples, 0.0f);
+    right.assign(numSamples, 0.0f);
+
+    for (int start = 0; start < numSamples; start += blockSize)
+    {
+        float* outputs[2] = { left.data() + start, right.data() + start };
+        synth.process(outputs, 2, std::min(blockSize, numSamples - start));
+    }
+}
+
+void test_StringPureDSP_HostBlockSizes()
+{
+    const int numSamples = 32768;
+    std::vector<float> refLeft, refRight;
+    renderStringPureDSP(32, refLeft, refRight, numSamples);
+
+    float peak = 0.0f;
+    for (float x : refLeft)
+        peak = std::max(peak, std::abs(x));
+
+    TEST_ASSERT(peak > 0.001f, "StringPureDSP reference render is not silent");
+
+    for (int blockSize : { 1, 31, 512, 4096, 16384 })
+    {
+        std::vector<float> left, right;
+        renderStringPureDSP(blockSize, left, right, numSamples);
+
+        bool finite = true;
+        float maxDiff = 0.0f;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            finite = finite && std::isfinite(left[i]) && std::isfinite(right[i]);
+            maxDiff = std::max({ maxDiff, std::abs(left[i] - refLeft[i]), std::abs(right[i] - refRight[i]) });
+        }
+
+        const std::string size = std::to_string(blockSize);
+        TEST_ASSERT(finite, "StringPureDSP output is finite at " + size + "-sample blocks");
+        TEST_ASSERT(maxDiff <= peak * 1.0e-5f, "StringPureDSP output at " + size + "-sample blocks matches the 32-sample render");
+    }
+}
+
+//==============================================================================
+// Category: StringPureDSP Parameter Registry
+//==============================================================================
+
+void test_StringPureDSP_ParameterIndexRoundTrip()
+{
+    DSP::StringPureDSP synth;
+    synth.prepare(48000.0, 512);
+
+    // id and an in-range value that is not the default
+    const std::pair<const char*, float> params[] = {
+        { "master_volume", 1.5f }, { "string_damping", 0.9f }, { "string_stiffness", 0.25f },
+        { "string_brightness", 0.75f }, { "bridge_coupling", 0.5f }, { "body_resonance", 1.25f },
+        { "attack_time", 0.5f }, { "decay_time", 4.0f }, { "sustain_level", 0.375f },
+        { "release_time", 8.0f },
+    };
+
+    TEST_ASSERT(synth.getNumParameters() == static_cast<int>(std::size(params)), "StringPureDSP registers every parameter");
+    TEST_ASSERT(synth.getParameterIndex("no_such_parameter") == -1, "StringPureDSP unknown id has no index");
+
+    std::vector<bool> seen(static_cast<size_t>(synth.getNumParameters()), false);
+
+    for (const auto& [id, value] : params)
+    {
+        const int index = synth.getParameterIndex(id);
+        const std::string name = id;
+        TEST_ASSERT(index >= 0 && index < synth.getNumParameters() && !seen[static_cast<size_t>(index)],
+                    "StringPureDSP " + name + " has its own index");
+        seen[static_cast<size_t>(index)] = true;
+
+        synth.setParameterValue(index, value);
+        TEST_ASSERT(synth.getParameter(id) == value, "StringPureDSP " + name + " index set reads back by id");
+
+        synth.setParameter(id, 0.0f);
+        TEST_ASSERT(synth.getParameterValue(index) == 0.0f, "StringPureDSP " + name + " id set reads back by index");
+    }
+}
+
 //==============================================================================
 // Test Runner
 //==============================================================================
@@ -1424,6 +1531,14 @@ int main()
     test_Pedalboard_CPUPerformance();
     test_Pedalboard_RealtimeSafety();
 
+    std::cout << "\n🧩 StringPureDSP Host Block Size Tests:\n";
+    std::cout << "─────────────────────────────────────────────────────────────\n";
+    test_StringPureDSP_HostBlockSizes();
+
+    std::cout << "\n🗂️ StringPureDSP Parameter Registry Tests:\n";
+    std::cout << "─────────────────────────────────────────────────────────────\n";
+    test_StringPureDSP_ParameterIndexRoundTrip();
+
     std::cout << "\n";
     std::cout << "═══════════════════════════════════════════════════════════════\n";
     std::cout << "  Test Results\n";
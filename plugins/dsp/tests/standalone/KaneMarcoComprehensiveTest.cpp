@@ -13,8 +13,15 @@
 #include "../include/dsp/MotionPureDSP.h"
 #include <iostream>
 #include <cstdio>
+#include <cstring>
 #include <cmath>
+#include <chrono>
+#include <complex>
+#include <algorithm>
 #include <vector>
+#include <string>
+#include <atomic>
+#include <thread>
 
 using namespace DSP;
 
@@ -373,6 +380,1354 @@ bool testStereoWidth(TestStats& stats) {
     return true;
 }
 
+//==============================================================================
+// Test 8: Lane Renderer Matches Scalar Voices
+//==============================================================================
+
+void renderVoices(VoiceManager& voices, std::vector<float>& out, int numSamples, int blockSize = 512) {
+    out.assign(numSamples, 0.0f);
+    for (int offset = 0; offset < numSamples; offset += blockSize) {
+        voices.processBlock(out.data() + offset, std::min(blockSize, numSamples - offset), 48000.0);
+    }
+}
+
+bool testLaneRendererMatchesScalar(TestStats& stats) {
+    std::cout << "\n[Test 8] Lane Renderer Matches Scalar Voices" << std::endl;
+
+    VoiceManager scalar, lanes;
+    scalar.setRenderPath(VoiceRenderPath::Scalar);
+    lanes.setRenderPath(VoiceRenderPath::Lanes);
+
+    // 12 voices: one full lane group and one partly filled
+    for (VoiceManager* vm : { &scalar, &lanes }) {
+        vm->prepare(48000.0, 512);
+        for (int v = 0; v < 12; ++v) {
+            vm->handleNoteOn(48 + v * 2, 0.8f);
+        }
+    }
+
+    std::vector<float> a, b;
+    renderVoices(scalar, a, 24000);
+    renderVoices(lanes, b, 24000);
+
+    // release half of them and render the tails
+    for (VoiceManager* vm : { &scalar, &lanes }) {
+        for (int v = 0; v < 12; v += 2) {
+            vm->handleNoteOff(48 + v * 2);
+        }
+    }
+
+    std::vector<float> tailA, tailB;
+    renderVoices(scalar, tailA, 24000);
+    renderVoices(lanes, tailB, 24000);
+    a.insert(a.end(), tailA.begin(), tailA.end());
+    b.insert(b.end(), tailB.begin(), tailB.end());
+
+    const float peak = getPeakLevel(a.data(), static_cast<int>(a.size()));
+    float maxDiff = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i) {
+        maxDiff = std::max(maxDiff, std::abs(a[i] - b[i]));
+    }
+
+    std::cout << "    Peak: " << peak << ", max difference: " << maxDiff << std::endl;
+
+    // only the order of the voice sum differs
+    if (peak < 0.001f || maxDiff > peak * 1.0e-4f) {
+        stats.fail("lane_renderer_matches_scalar", "Lane output differs from the scalar voices");
+        return false;
+    }
+
+    if (scalar.getActiveVoiceCount() != lanes.getActiveVoiceCount()) {
+        stats.fail("lane_renderer_voice_state", "Voice state was not written back from the lanes");
+        return false;
+    }
+
+    stats.pass("lane_renderer_matches_scalar");
+    return true;
+}
+
+//==============================================================================
+// Test 9: Lane Renderer Throughput (16 Voices)
+//==============================================================================
+
+double measureNsPerVoiceSample(VoiceManager& voices, int numVoices, double seconds) {
+    std::vector<float> block(512);
+    const int numBlocks = static_cast<int>(seconds * 48000.0) / 512;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int b = 0; b < numBlocks; ++b) {
+        voices.processBlock(block.data(), 512, 48000.0);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double, std::nano> elapsed = end - start;
+    return elapsed.count() / (static_cast<double>(numBlocks) * 512.0 * numVoices);
+}
+
+bool testLaneRendererThroughput(TestStats& stats) {
+    std::cout << "\n[Test 9] Lane Renderer Throughput (16 Voices)" << std::endl;
+
+    constexpr int numVoices = 16;
+    double ns[2] = {};
+    const VoiceRenderPath paths[2] = { VoiceRenderPath::Scalar, VoiceRenderPath::Lanes };
+
+    for (int p = 0; p < 2; ++p) {
+        VoiceManager voices;
+        voices.setRenderPath(paths[p]);
+        voices.prepare(48000.0, 512);
+        for (int v = 0; v < numVoices; ++v) {
+            voices.handleNoteOn(40 + v * 3, 0.8f);
+        }
+
+        measureNsPerVoiceSample(voices, numVoices, 0.5);  // warm-up
+        ns[p] = measureNsPerVoiceSample(voices, numVoices, 5.0);
+    }
+
+    std::printf("    Scalar (AoS):  %6.2f ns per voice-sample\n", ns[0]);
+    std::printf("    Lanes  (SoA):  %6.2f ns per voice-sample (%.2fx)\n", ns[1], ns[0] / ns[1]);
+
+    // Report only: wall-clock ratios depend on the machine and its load, and
+    // the lane/scalar equivalence tests cover correctness
+    stats.pass("lane_renderer_throughput");
+    return true;
+}
+
+//==============================================================================
+// Test 10: Voice Pool Sized At Prepare (128 Voices)
+//==============================================================================
+
+bool testConfigurablePolyphony(TestStats& stats) {
+    std::cout << "\n[Test 10] Voice Pool Sized At Prepare (128 Voices)" << std::endl;
+
+    MotionPureDSP synth;
+    synth.setMaxPolyphony(128);
+    synth.prepare(48000.0, 512);
+
+    if (synth.getMaxPolyphony() != 128) {
+        stats.fail("polyphony_prepare", "Pool was not sized to the requested polyphony");
+        return false;
+    }
+
+    ScheduledEvent event;
+    event.type = ScheduledEvent::NOTE_ON;
+    event.time = 0.0;
+    event.sampleOffset = 0;
+    event.data.note.velocity = 0.5f;
+    for (int note = 0; note < 128; ++note) {
+        event.data.note.midiNote = note;
+        synth.handleEvent(event);
+    }
+
+    std::vector<float> left(4800), right(4800);
+    processAudioInChunks(synth, left.data(), right.data(), 4800);
+
+    std::cout << "    Active after 128 notes: " << synth.getActiveVoiceCount() << std::endl;
+    if (synth.getActiveVoiceCount() != 128) {
+        stats.fail("polyphony_128", "Expected 128 sounding voices");
+        return false;
+    }
+
+    // release everything; finished voices return to the free list
+    event.type = ScheduledEvent::NOTE_OFF;
+    for (int note = 0; note < 128; ++note) {
+        event.data.note.midiNote = note;
+        synth.handleEvent(event);
+    }
+
+    std::vector<float> tailL(96000), tailR(96000);
+    processAudioInChunks(synth, tailL.data(), tailR.data(), 96000);
+
+    std::cout << "    Active after release: " << synth.getActiveVoiceCount() << std::endl;
+    if (synth.getActiveVoiceCount() != 0) {
+        stats.fail("polyphony_release", "Released voices were not freed");
+        return false;
+    }
+
+    stats.pass("configurable_polyphony");
+    return true;
+}
+
+//==============================================================================
+// Test 11: Voice Stealing Order
+//==============================================================================
+
+bool testVoiceStealing(TestStats& stats) {
+    std::cout << "\n[Test 11] Voice Stealing Order" << std::endl;
+
+    VoiceManager voices;
+    voices.setPolyphony(4);
+    voices.prepare(48000.0, 512);
+
+    std::vector<float> block;
+    for (int note = 60; note < 64; ++note) {
+        voices.handleNoteOn(note, 0.8f);
+        renderVoices(voices, block, 512);
+    }
+
+    // a released voice goes before any held one
+    Voice* released = voices.findVoiceForNote(61);
+    voices.handleNoteOff(61);
+    voices.handleNoteOn(64, 0.8f);
+
+    if (voices.findVoiceForNote(64) != released || voices.findVoiceForNote(61) != nullptr) {
+        stats.fail("steal_released_first", "New note did not take the released voice");
+        return false;
+    }
+
+    // then the oldest held voice
+    Voice* oldest = voices.findVoiceForNote(60);
+    voices.handleNoteOn(65, 0.8f);
+
+    if (voices.findVoiceForNote(65) != oldest || voices.findVoiceForNote(60) != nullptr
+        || voices.getActiveVoiceCount() != 4) {
+        stats.fail("steal_oldest_held", "New note did not take the oldest held voice");
+        return false;
+    }
+
+    if (oldest->startTime <= voices.findVoiceForNote(63)->startTime) {
+        stats.fail("steal_start_time", "Stolen voice was not restamped at note-on");
+        return false;
+    }
+
+    stats.pass("voice_stealing");
+    return true;
+}
+
+//==============================================================================
+// Test 12: Arbitrary Host Block Sizes
+//==============================================================================
+
+bool testHostBlockSizes(TestStats& stats) {
+    std::cout << "\n[Test 12] Arbitrary Host Block Sizes" << std::endl;
+
+    const int numSamples = 32768;
+    const int blockSizes[] = { 1, 31, 512, 4096, 16384 };
+    std::vector<float> reference;
+
+    for (int blockSize : blockSizes) {
+        MotionPureDSP synth;
+        synth.prepare(48000.0, 512);  // host announced 512, then sends other sizes
+
+        ScheduledEvent event;
+        event.type = ScheduledEvent::NOTE_ON;
+        event.time = 0.0;
+        event.sampleOffset = 0;
+        event.data.note.velocity = 0.7f;
+        for (int note : { 48, 55, 60, 64 }) {
+            event.data.note.midiNote = note;
+            synth.handleEvent(event);
+        }
+
+        std::vector<float> left(numSamples), right(numSamples);
+        processAudioInChunks(synth, left.data(), right.data(), numSamples, blockSize);
+
+        if (reference.empty()) {
+            reference = left;
+        }
+
+        const float peak = getPeakLevel(reference.data(), numSamples);
+        float maxDiff = 0.0f;
+        for (int i = 0; i < numSamples; ++i) {
+            maxDiff = std::max(maxDiff, std::abs(left[i] - reference[i]));
+            maxDiff = std::max(maxDiff, std::abs(right[i] - left[i]));
+        }
+
+        std::cout << "    " << blockSize << " samples: max difference = " << maxDiff << std::endl;
+
+        // the output must not depend on how the host slices the stream
+        if (peak < 0.001f || maxDiff > peak * 1.0e-5f) {
+            stats.fail(("block_size_" + std::to_string(blockSize)).c_str(), "Output depends on host block size");
+            return false;
+        }
+    }
+
+    stats.pass("host_block_sizes");
+    return true;
+}
+
+//==============================================================================
+// Test 13: Wavetable Engine vs PolyBLEP (CPU and Aliasing)
+//==============================================================================
+
+// Power outside the harmonics of bin `fundamentalBin`, relative to the
+// harmonics, in dB (radix-2 DFT of a whole number of cycles)
+double measureAliasingDb(std::vector<float> signal, int fundamentalBin) {
+    const size_t n = signal.size();
+    std::vector<std::complex<double>> bins(signal.begin(), signal.end());
+
+    for (size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(bins[i], bins[j]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        const std::complex<double> step = std::polar(1.0, -2.0 * M_PI / static_cast<double>(len));
+        for (size_t start = 0; start < n; start += len) {
+            std::complex<double> w(1.0, 0.0);
+            for (size_t k = 0; k < len / 2; ++k, w *= step) {
+                const auto odd = bins[start + k + len / 2] * w;
+                bins[start + k + len / 2] = bins[start + k] - odd;
+                bins[start + k] += odd;
+            }
+        }
+    }
+
+    double harmonic = 0.0, alias = 0.0;
+    for (size_t k = 1; k < n / 2; ++k) {
+        const double power = std::norm(bins[k]);
+        (k % static_cast<size_t>(fundamentalBin) == 0 ? harmonic : alias) += power;
+    }
+    return 10.0 * std::log10(alias / harmonic);
+}
+
+std::vector<float> renderOscillator(OscillatorEngine engine, Waveform shape, float warp, double freq, int numSamples) {
+    Oscillator osc;
+    osc.prepare(48000.0);
+    osc.setEngine(engine);
+    osc.setWaveform(static_cast<int>(shape));
+    osc.setWarp(warp);
+    osc.setFrequency(static_cast<float>(freq), 48000.0);
+
+    std::vector<float> out(static_cast<size_t>(numSamples));
+    for (auto& sample : out) {
+        sample = osc.processSample();
+    }
+    return out;
+}
+
+bool testWavetableEngine(TestStats& stats) {
+    std::cout << "\n[Test 13] Wavetable Engine vs PolyBLEP (CPU and Aliasing)" << std::endl;
+
+    // 181 cycles in 4096 samples (~2.1 kHz): aliases never land on a harmonic bin
+    constexpr int fftSize = 4096;
+    constexpr int fundamentalBin = 181;
+    const double freq = 48000.0 * fundamentalBin / fftSize;
+
+    struct Case { const char* name; Waveform shape; float warp; };
+    const Case cases[] = {
+        { "saw", Waveform::SAW, 0.0f },
+        { "square", Waveform::SQUARE, 0.0f },
+        { "triangle", Waveform::TRIANGLE, 0.0f },
+        { "saw, warp 0.5", Waveform::SAW, 0.5f },
+    };
+
+    for (const auto& c : cases) {
+        const double blep = measureAliasingDb(renderOscillator(OscillatorEngine::POLYBLEP, c.shape, c.warp, freq, fftSize), fundamentalBin);
+        const double table = measureAliasingDb(renderOscillator(OscillatorEngine::WAVETABLE, c.shape, c.warp, freq, fftSize), fundamentalBin);
+
+        std::printf("    %-14s aliasing: PolyBLEP %6.1f dB, wavetable %6.1f dB\n", c.name, blep, table);
+
+        if (table > -60.0 || table > blep) {
+            stats.fail("wavetable_aliasing", std::string("Wavetable aliasing too high for ") + c.name);
+            return false;
+        }
+    }
+
+    // CPU: one oscillator, saw with warp (the common preset case)
+    double ns[2] = {};
+    const OscillatorEngine engines[2] = { OscillatorEngine::POLYBLEP, OscillatorEngine::WAVETABLE };
+    for (int e = 0; e < 2; ++e) {
+        constexpr int numSamples = 48000 * 4;
+        auto start = std::chrono::high_resolution_clock::now();
+        const auto out = renderOscillator(engines[e], Waveform::SAW, 0.3f, 220.0, numSamples);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::chrono::duration<double, std::nano> elapsed = end - start;
+        ns[e] = elapsed.count() / numSamples;
+
+        if (getPeakLevel(out.data(), numSamples) < 0.5f) {
+            stats.fail("wavetable_output", "Oscillator is silent");
+            return false;
+        }
+    }
+
+    std::printf("    CPU: PolyBLEP %5.2f ns/sample, wavetable %5.2f ns/sample (%.2fx)\n", ns[0], ns[1], ns[0] / ns[1]);
+
+    stats.pass("wavetable_engine");
+    return true;
+}
+
+//==============================================================================
+// Test 14: Compiled Modulation Matrix (Control Rate)
+//==============================================================================
+
+void setModRoute(ModulationMatrix& matrix, int slot, ModSource source, ModDestination destination, float amount) {
+    matrix.slots[slot].source = source;
+    matrix.slots[slot].destination = destination;
+    matrix.slots[slot].amount.store(amount);
+}
+
+// Renders voices the way MotionPureDSP does: sources advanced and routes
+// applied at the start of every control block
+void renderModulatedVoices(VoiceManager& voices, ModulationMatrix& matrix, const MotionPureDSP& synth,
+                           std::vector<float>& out, int numSamples, int controlRate) {
+    out.assign(numSamples, 0.0f);
+    for (int offset = 0; offset < numSamples; offset += controlRate) {
+        const int len = std::min(controlRate, numSamples - offset);
+        matrix.advanceSources(len);
+        voices.applyModulation(synth, matrix, len);
+        voices.processBlock(out.data() + offset, len, 48000.0);
+    }
+}
+
+bool testModulationMatrix(TestStats& stats) {
+    std::cout << "\n[Test 14] Compiled Modulation Matrix (Control Rate)" << std::endl;
+
+    MotionPureDSP synth;
+    synth.prepare(48000.0, 512);
+
+    constexpr int numSamples = 48000;
+    constexpr int controlRate = 32;
+
+    auto makeMatrix = [](ModulationMatrix& matrix, bool withRoutes) {
+        matrix.prepare(48000.0);
+        matrix.lfo1.setRate(5.0f, 48000.0);
+        matrix.lfo2.setRate(0.7f, 48000.0);
+        if (withRoutes) {
+            setModRoute(matrix, 0, ModSource::LFO1, ModDestination::FILTER_CUTOFF, -0.5f);
+            matrix.slots[0].bipolar = false;  // sweep down from the cutoff only
+            setModRoute(matrix, 1, ModSource::LFO2, ModDestination::OSC1_LEVEL, -0.4f);
+            setModRoute(matrix, 2, ModSource::AMP_ENV, ModDestination::OSC2_WARP, 0.3f);
+            setModRoute(matrix, 3, ModSource::LFO1, ModDestination::OSC1_FREQ, 0.02f);
+            setModRoute(matrix, 4, ModSource::LFO2, ModDestination::LFO1_RATE, 1.0f);  // not a voice destination
+        }
+        matrix.compile();
+    };
+
+    auto startVoices = [](VoiceManager& voices, VoiceRenderPath path) {
+        voices.setRenderPath(path);
+        voices.prepare(48000.0, 512);
+        for (int v = 0; v < 6; ++v) {
+            voices.handleNoteOn(48 + v * 3, 0.8f);
+        }
+    };
+
+    // only voice destinations are compiled into routes
+    ModulationMatrix routed;
+    makeMatrix(routed, true);
+    if (routed.getNumRoutes() != 4) {
+        stats.fail("mod_matrix_compile", "Unexpected number of compiled routes");
+        return false;
+    }
+
+    // an empty matrix leaves the voices exactly as rendered without one
+    std::vector<float> plain, empty;
+    {
+        VoiceManager voices;
+        startVoices(voices, VoiceRenderPath::Lanes);
+        renderVoices(voices, plain, numSamples);
+    }
+    {
+        VoiceManager voices;
+        ModulationMatrix matrix;
+        makeMatrix(matrix, false);
+        startVoices(voices, VoiceRenderPath::Lanes);
+        renderModulatedVoices(voices, matrix, synth, empty, numSamples, controlRate);
+    }
+    if (plain != empty) {
+        stats.fail("mod_matrix_empty", "Empty matrix changed the output");
+        return false;
+    }
+
+    // routes reach the voices, and lanes agree with the scalar voices
+    std::vector<float> scalarOut, laneOut;
+    {
+        VoiceManager voices;
+        ModulationMatrix matrix;
+        makeMatrix(matrix, true);
+        startVoices(voices, VoiceRenderPath::Scalar);
+        renderModulatedVoices(voices, matrix, synth, scalarOut, numSamples, controlRate);
+    }
+    {
+        VoiceManager voices;
+        ModulationMatrix matrix;
+        makeMatrix(matrix, true);
+        startVoices(voices, VoiceRenderPath::Lanes);
+        renderModulatedVoices(voices, matrix, synth, laneOut, numSamples, controlRate);
+    }
+
+    const float peak = getPeakLevel(scalarOut.data(), numSamples);
+    float laneDiff = 0.0f, modDiff = 0.0f;
+    for (int i = 0; i < numSamples; ++i) {
+        laneDiff = std::max(laneDiff, std::abs(scalarOut[i] - laneOut[i]));
+        modDiff = std::max(modDiff, std::abs(scalarOut[i] - plain[i]));
+    }
+
+    std::cout << "    Peak: " << peak << ", routed vs unmodulated: " << modDiff << ", lanes vs scalar: " << laneDiff << std::endl;
+
+    if (peak < 0.001f || modDiff < peak * 0.05f) {
+        stats.fail("mod_matrix_routes", "Routes did not change the output");
+        return false;
+    }
+    if (laneDiff > peak * 1.0e-4f) {
+        stats.fail("mod_matrix_lanes", "Modulated lanes differ from the scalar voices");
+        return false;
+    }
+
+    // an LFO route keeps moving after a host reset (the rates survive it):
+    // two LFO rates must still render differently
+    auto renderAfterReset = [](float lfoRate, bool resetFirst) {
+        MotionPureDSP s;
+        s.prepare(48000.0, 512);
+        s.setParameter("lfo1_rate", lfoRate);
+        s.setParameter("mod_0_source", static_cast<float>(ModSource::LFO1));
+        s.setParameter("mod_0_destination", static_cast<float>(ModDestination::FILTER_CUTOFF));
+        s.setParameter("mod_0_amount", 0.8f);
+        if (resetFirst) {
+            s.reset();
+        }
+
+        ScheduledEvent noteOn;
+        noteOn.type = ScheduledEvent::NOTE_ON;
+        noteOn.data.note.midiNote = 48;
+        noteOn.data.note.velocity = 0.8f;
+        s.handleEvent(noteOn);
+
+        std::vector<float> left(8192), right(8192);
+        float* outputs[2] = { left.data(), right.data() };
+        s.process(outputs, 2, 8192);
+        return left;
+    };
+
+    for (bool resetFirst : { false, true }) {
+        const std::vector<float> slow = renderAfterReset(2.0f, resetFirst);
+        const std::vector<float> fast = renderAfterReset(9.0f, resetFirst);
+        float rateDiff = 0.0f;
+        for (size_t i = 0; i < slow.size(); ++i) {
+            rateDiff = std::max(rateDiff, std::abs(slow[i] - fast[i]));
+        }
+        if (rateDiff < getPeakLevel(slow.data(), 8192) * 0.05f) {
+            stats.fail("mod_matrix_reset", resetFirst ? "LFO route frozen after reset()" : "LFO route did not follow its rate");
+            return false;
+        }
+    }
+
+    // cost of a full matrix against an empty one, 16 voices
+    double ns[2] = {};
+    for (int m = 0; m < 2; ++m) {
+        VoiceManager voices;
+        ModulationMatrix matrix;
+        makeMatrix(matrix, false);
+        if (m == 1) {
+            const ModDestination destinations[] = {
+                ModDestination::OSC1_FREQ, ModDestination::OSC1_WARP, ModDestination::OSC1_LEVEL,
+                ModDestination::OSC2_FREQ, ModDestination::OSC2_WARP, ModDestination::OSC2_LEVEL,
+                ModDestination::SUB_LEVEL, ModDestination::FILTER_CUTOFF };
+            for (int slot = 0; slot < 16; ++slot) {
+                setModRoute(matrix, slot, slot % 2 ? ModSource::LFO1 : ModSource::LFO2, destinations[slot % 8], 0.05f);
+            }
+            matrix.compile();
+        }
+
+        voices.prepare(48000.0, 512);
+        for (int v = 0; v < 16; ++v) {
+            voices.handleNoteOn(40 + v * 3, 0.8f);
+        }
+
+        std::vector<float> out;
+        auto start = std::chrono::high_resolution_clock::now();
+        renderModulatedVoices(voices, matrix, synth, out, 48000 * 2, controlRate);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::chrono::duration<double, std::nano> elapsed = end - start;
+        ns[m] = elapsed.count() / (48000.0 * 2.0 * 16.0);
+    }
+
+    std::printf("    16 voices: empty matrix %5.2f ns, 16 routes %5.2f ns per voice-sample\n", ns[0], ns[1]);
+
+    stats.pass("modulation_matrix");
+    return true;
+}
+
+//==============================================================================
+// Test 15: Segment Envelope (Block vs Per-Sample)
+//==============================================================================
+
+// Attack, decay, a sustain hold, a release started mid-decay on a second
+// note, and the idle tail: every stage and transition in 20000 samples
+void renderEnvelope(Envelope& env, std::vector<float>& out, int blockSize, bool perSample) {
+    const int numSamples = 20000;
+    const int gateOff[] = { 9000, 16000 };
+    const int gateOn[] = { 0, 13000 };
+
+    out.assign(numSamples, 0.0f);
+    for (int offset = 0; offset < numSamples; ) {
+        int len = std::min(blockSize, numSamples - offset);
+        for (int g = 0; g < 2; ++g) {
+            if (offset == gateOn[g]) env.noteOn();
+            if (offset == gateOff[g]) env.noteOff();
+            for (int edge : { gateOn[g], gateOff[g] }) {
+                if (edge > offset) len = std::min(len, edge - offset);
+            }
+        }
+
+        if (perSample) {
+            for (int i = 0; i < len; ++i) out[offset + i] = env.processSample();
+        } else {
+            env.processBlock(out.data() + offset, len);
+        }
+        offset += len;
+    }
+}
+
+bool testSegmentEnvelope(TestStats& stats) {
+    std::cout << "\n[Test 15] Segment Envelope (Block vs Per-Sample)" << std::endl;
+
+    Envelope::Parameters params;
+    params.attack = 0.01f;
+    params.decay = 0.05f;
+    params.sustain = 0.4f;
+    params.release = 0.08f;
+
+    std::vector<float> reference;
+    {
+        Envelope env;
+        env.prepare(48000.0);
+        env.setParameters(params);
+        renderEnvelope(env, reference, 1, true);
+    }
+
+    // the stage shape: peak of 1, sustain held, silent once released
+    if (std::abs(getPeakLevel(reference.data(), 20000) - 1.0f) > 1.0e-6f
+        || reference[8000] != params.sustain || reference[19999] != 0.0f) {
+        stats.fail("segment_envelope_shape", "Envelope stages are wrong");
+        return false;
+    }
+
+    // attack reaches 1 after attack * sampleRate samples
+    const auto peakAt = std::find(reference.begin(), reference.end(), 1.0f) - reference.begin();
+    if (peakAt < 479 || peakAt > 480) {
+        stats.fail("segment_envelope_timing", "Attack length is wrong: " + std::to_string(peakAt));
+        return false;
+    }
+
+    for (int blockSize : { 1, 7, 64, 512, 20000 }) {
+        Envelope env;
+        env.prepare(48000.0);
+        env.setParameters(params);
+
+        std::vector<float> block;
+        renderEnvelope(env, block, blockSize, false);
+
+        if (block != reference) {
+            stats.fail("segment_envelope_blocks", "processBlock differs from processSample at block size " + std::to_string(blockSize));
+            return false;
+        }
+    }
+
+    // CPU: 16 envelopes over 512-sample blocks
+    double ns[2] = {};
+    params.release = 10.0f;  // keep every envelope ramping
+    for (int m = 0; m < 2; ++m) {
+        Envelope envs[16];
+        for (auto& env : envs) {
+            env.prepare(48000.0);
+            env.setParameters(params);
+            env.noteOn();
+        }
+
+        std::vector<float> out(512);
+        float sink = 0.0f;
+        const int numBlocks = 2000;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int b = 0; b < numBlocks; ++b) {
+            for (auto& env : envs) {
+                if (b == numBlocks / 2) env.noteOff();
+                if (m == 0) {
+                    for (int i = 0; i < 512; ++i) out[i] = env.processSample();
+                } else {
+                    env.processBlock(out.data(), 512);
+                }
+                sink += out[511];
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::chrono::duration<double, std::nano> elapsed = end - start;
+        ns[m] = elapsed.count() / (numBlocks * 512.0 * 16.0);
+        if (sink < 0.0f) std::cout << sink;  // keep the loop
+    }
+
+    std::printf("    processSample %5.2f ns, processBlock %5.2f ns per envelope-sample (%.2fx)\n", ns[0], ns[1], ns[0] / ns[1]);
+
+    stats.pass("segment_envelope");
+    return true;
+}
+
+//==============================================================================
+// Test 16: ZDF Filter With Envelope, Key and Velocity Tracking
+//==============================================================================
+
+bool testFilterModulation(TestStats& stats) {
+    std::cout << "\n[Test 16] ZDF Filter With Envelope, Key and Velocity Tracking" << std::endl;
+
+    // stable at the top of the range: full resonance, cutoff near Nyquist
+    {
+        SVFFilter filter;
+        filter.prepare(48000.0);
+        filter.setResonance(1.0f);
+        filter.setCutoff(20000.0f);
+        float peak = 0.0f;
+        for (int i = 0; i < 48000; ++i) {
+            const float x = (i % 37 < 18) ? 1.0f : -1.0f;
+            peak = std::max(peak, std::abs(filter.processSample(x)));
+        }
+        if (!std::isfinite(peak) || peak > 1000.0f) {
+            stats.fail("zdf_filter_stable", "Filter blew up at full resonance");
+            return false;
+        }
+    }
+
+    // a low lowpass opened by the filter envelope, key and velocity tracking
+    MotionPureDSP synth;
+    synth.prepare(48000.0, 512);
+    synth.setParameter("filter_cutoff", 0.02f);  // 400 Hz
+    synth.setParameter("filter_env_attack", 0.05f);
+    synth.setParameter("filter_env_decay", 0.2f);
+    synth.setParameter("filter_env_sustain", 0.2f);
+    synth.setParameter("filter_env_amount", 0.8f);
+    synth.setParameter("filter_key_track", 1.0f);
+    synth.setParameter("filter_vel_track", 0.5f);
+
+    constexpr int numSamples = 24000;
+    std::vector<float> outs[2];
+    const VoiceRenderPath paths[2] = { VoiceRenderPath::Scalar, VoiceRenderPath::Lanes };
+    for (int p = 0; p < 2; ++p) {
+        VoiceManager voices;
+        voices.setRenderPath(paths[p]);
+        voices.prepare(48000.0, 512);
+        voices.updateVoiceParameters(synth);
+        for (int v = 0; v < 10; ++v) {
+            voices.handleNoteOn(36 + v * 4, 0.3f + v * 0.07f);
+        }
+        renderVoices(voices, outs[p], numSamples, 100);
+    }
+
+    const float peak = getPeakLevel(outs[0].data(), numSamples);
+    float maxDiff = 0.0f;
+    for (int i = 0; i < numSamples; ++i) {
+        maxDiff = std::max(maxDiff, std::abs(outs[0][i] - outs[1][i]));
+    }
+
+    // brightness: sample-to-sample movement while the envelope is up vs
+    // once it has decayed to sustain
+    auto roughness = [&](int start) {
+        float sum = 0.0f;
+        for (int i = start + 1; i < start + 2400; ++i) sum += std::abs(outs[0][i] - outs[0][i - 1]);
+        return sum;
+    };
+    const float open = roughness(2400);
+    const float closed = roughness(21000);
+
+    std::cout << "    Lanes vs scalar: " << maxDiff << ", roughness at envelope peak "
+              << open << " vs sustain " << closed << std::endl;
+
+    if (peak < 0.001f || maxDiff > peak * 1.0e-4f) {
+        stats.fail("filter_modulation_lanes", "Filter modulation differs between lanes and scalar voices");
+        return false;
+    }
+    if (open < closed * 1.5f) {
+        stats.fail("filter_envelope", "Filter envelope did not open the cutoff");
+        return false;
+    }
+
+    // CPU: 16 voices, static cutoff against envelope-modulated cutoff
+    double ns[2] = {};
+    for (int m = 0; m < 2; ++m) {
+        synth.setParameter("filter_env_amount", m == 0 ? 0.0f : 0.8f);
+        synth.setParameter("filter_env_sustain", m == 0 ? 0.2f : 0.0f);
+        synth.setParameter("filter_env_decay", 30.0f);  // keep the cutoff moving
+
+        VoiceManager voices;
+        voices.prepare(48000.0, 512);
+        voices.updateVoiceParameters(synth);
+        for (int v = 0; v < 16; ++v) {
+            voices.handleNoteOn(40 + v * 3, 0.8f);
+        }
+
+        measureNsPerVoiceSample(voices, 16, 0.2);  // warm-up
+        ns[m] = measureNsPerVoiceSample(voices, 16, 2.0);
+    }
+
+    std::printf("    16 voices: static cutoff %5.2f ns, modulated %5.2f ns per voice-sample\n", ns[0], ns[1]);
+
+    stats.pass("filter_modulation");
+    return true;
+}
+
+//==============================================================================
+// Test 17: Parameter Registry (Perfect-Hash Lookup, Preset Round Trip)
+//==============================================================================
+
+bool testParameterRegistry(TestStats& stats) {
+    std::cout << "\n[Test 17] Parameter Registry (Perfect-Hash Lookup, Preset Round Trip)" << std::endl;
+
+    MotionPureDSP synth;
+    synth.prepare(48000.0, 512);
+
+    // every table entry resolves to its own index, by id and by index
+    const int numParams = synth.getNumParameters();
+    const char* ids[] = { "osc1_shape", "osc2_level", "filter_cutoff", "filter_env_decay",
+                          "lfo2_bipolar", "master_volume", "pitch_bend_range" };
+    for (const char* id : ids) {
+        const int index = synth.getParameterIndex(id);
+        if (index < 0 || index >= numParams || synth.getParameter(id) != synth.getParameterValue(index)) {
+            stats.fail("registry_lookup", std::string("Lookup failed for ") + id);
+            return false;
+        }
+    }
+
+    // unknown and near-miss ids, and mod slots (parsed, not in the table)
+    const char* unknown[] = { "", "osc1_shap", "osc1_shapes", "Master_volume", "mod_0_amount" };
+    for (const char* id : unknown) {
+        if (synth.getParameterIndex(id) != -1) {
+            stats.fail("registry_unknown", std::string("Unexpected index for ") + id);
+            return false;
+        }
+    }
+    synth.setParameter("mod_3_amount", 0.25f);
+    if (synth.getParameter("mod_3_amount") != 0.25f) {
+        stats.fail("registry_mod_slot", "Mod slot parameter not stored");
+        return false;
+    }
+
+    // every generated mod slot id resolves to its own field
+    const char* fields[] = { "source", "destination", "amount", "bipolar", "curve" };
+    for (int slot = 0; slot < 16; ++slot) {
+        for (int f = 0; f < 5; ++f) {
+            char id[32];
+            std::snprintf(id, sizeof(id), "mod_%d_%s", slot, fields[f]);
+            const float value = (f == 2) ? -0.5f : 1.0f;
+            synth.setParameter(id, value);
+            if (synth.getParameter(id) != value) {
+                stats.fail("registry_mod_slot", std::string("Mod slot id not resolved: ") + id);
+                return false;
+            }
+            synth.setParameter(id, 0.0f);
+        }
+    }
+    synth.setParameter("mod_16_amount", 0.5f);
+    if (synth.getParameter("mod_16_amount") != 0.0f || synth.getParameter("mod_3_amoun") != 0.0f) {
+        stats.fail("registry_mod_slot", "Out-of-range mod slot id resolved");
+        return false;
+    }
+
+    // values are clamped to the descriptor range
+    synth.setParameter("filter_cutoff", 5.0f);
+    if (synth.getParameter("filter_cutoff") != 1.0f) {
+        stats.fail("registry_clamp", "filter_cutoff not clamped to 1");
+        return false;
+    }
+
+    // preset save/load covers the whole table
+    for (int i = 0; i < numParams; ++i) {
+        synth.setParameterValue(i, synth.getParameterValue(i) * 0.5f + 0.125f);
+    }
+    char json[4096];
+    if (!synth.savePreset(json, sizeof(json))) {
+        stats.fail("registry_save", "savePreset failed");
+        return false;
+    }
+    MotionPureDSP loaded;
+    loaded.prepare(48000.0, 512);
+    loaded.loadPreset(json);
+    for (int i = 0; i < numParams; ++i) {
+        if (std::abs(loaded.getParameterValue(i) - synth.getParameterValue(i)) > 1.0e-4f) {
+            stats.fail("registry_round_trip", "Parameter " + std::to_string(i) + " did not survive save/load");
+            return false;
+        }
+    }
+
+    // lookup cost
+    const int iterations = 1000000;
+    volatile int sink = 0;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        sink = sink + synth.getParameterIndex(ids[i % 7]);
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+
+    std::printf("    %d parameters, %zu-byte preset, %.1f ns per id lookup\n", numParams, std::strlen(json), ns);
+
+    stats.pass("parameter_registry");
+    return true;
+}
+
+//==============================================================================
+// Test 18: Sample-Accurate Automation Queue
+//==============================================================================
+
+bool testAutomationQueue(TestStats& stats) {
+    std::cout << "\n[Test 18] Sample-Accurate Automation Queue" << std::endl;
+
+    const int blockSize = 512;
+    std::vector<float> left(blockSize), right(blockSize);
+    float* outputs[2] = { left.data(), right.data() };
+
+    MotionPureDSP synth;
+    synth.prepare(48000.0, blockSize);
+    const int volume = synth.getParameterIndex("master_volume");
+
+    auto startNote = [&](MotionPureDSP& s) {
+        ScheduledEvent noteOn;
+        noteOn.type = ScheduledEvent::NOTE_ON;
+        noteOn.time = 0.0;
+        noteOn.sampleOffset = 0;
+        noteOn.data.note.midiNote = 60;
+        noteOn.data.note.velocity = 0.8f;
+        s.handleEvent(noteOn);
+        for (int b = 0; b < 8; ++b) {
+            s.process(outputs, 2, blockSize);
+        }
+    };
+
+    // unsmoothed: the change lands exactly on its sample, mid-block
+    synth.setParameterSmoothing(false);
+    startNote(synth);
+    synth.scheduleParameterChange(volume, 0.0f, 137);
+    synth.process(outputs, 2, blockSize);
+    if (getPeakLevel(left.data(), 137) < 0.001f || getPeakLevel(left.data() + 137, blockSize - 137) != 0.0f) {
+        stats.fail("automation_sample_accurate", "master_volume change did not land on sample 137");
+        return false;
+    }
+
+    // offsets past the block carry over to the next call
+    synth.scheduleParameterChange(volume, 0.5f, blockSize + 10);
+    synth.process(outputs, 2, blockSize);
+    const float before = synth.getParameterValue(volume);
+    synth.process(outputs, 2, blockSize);
+    if (before != 0.0f || synth.getParameterValue(volume) != 0.5f || left[9] != 0.0f || std::abs(left[10]) + std::abs(left[20]) == 0.0f) {
+        stats.fail("automation_carry_over", "Late event not applied at its offset in the next block");
+        return false;
+    }
+
+    // events queued out of offset order are merged into offset order;
+    // equal offsets keep their queue order (the later one wins)
+    synth.scheduleParameterChange(volume, 0.2f, 300);
+    synth.scheduleParameterChange(volume, 0.0f, 100);
+    synth.scheduleParameterChange(volume, 0.6f, 100);
+    synth.scheduleParameterChange(volume, 0.0f, 200);
+    synth.process(outputs, 2, blockSize);
+    if (getPeakLevel(left.data() + 100, 100) == 0.0f || getPeakLevel(left.data() + 200, 100) != 0.0f ||
+        getPeakLevel(left.data() + 300, blockSize - 300) == 0.0f || synth.getParameterValue(volume) != 0.2f) {
+        stats.fail("automation_merge_order", "Out-of-order events not applied in offset order");
+        return false;
+    }
+    synth.setParameterValue(volume, 0.5f);
+
+    // a ramp starts on its event: the first control block still renders
+    // the start value, the next one the first step
+    {
+        MotionPureDSP ramped, held;
+        for (MotionPureDSP* s : { &ramped, &held }) {
+            s->prepare(48000.0, blockSize);
+            startNote(*s);
+        }
+        std::vector<float> heldLeft(blockSize), heldRight(blockSize);
+        float* heldOutputs[2] = { heldLeft.data(), heldRight.data() };
+        ramped.scheduleParameterChange(volume, 0.0f, 0);
+        ramped.process(outputs, 2, 64);
+        held.process(heldOutputs, 2, 64);
+        bool startsOnTime = true;
+        for (int i = 0; i < 32; ++i)
+            startsOnTime = startsOnTime && left[i] == heldLeft[i];
+        if (!startsOnTime || getPeakLevel(left.data() + 32, 32) >= getPeakLevel(heldLeft.data() + 32, 32)) {
+            stats.fail("automation_ramp_timing", "Ramp stepped before its first control block");
+            return false;
+        }
+    }
+
+    // smoothed: a step becomes a ramp over the parameter's smoothing time
+    synth.setParameterSmoothing(true);
+    synth.scheduleParameterChange(volume, 0.0f, 0);
+    synth.process(outputs, 2, 256);
+    const float midRamp = synth.getParameterValue(volume);
+    synth.process(outputs, 2, blockSize);
+    synth.process(outputs, 2, blockSize);
+    std::cout << "    Ramp: 0.5 -> " << midRamp << " after 256 samples -> " << synth.getParameterValue(volume) << std::endl;
+    if (!(midRamp > 0.1f && midRamp < 0.45f) || synth.getParameterValue(volume) != 0.0f) {
+        stats.fail("automation_ramp", "master_volume did not ramp to its target");
+        return false;
+    }
+
+    // a preset load drops the ramps on the parameters it sets
+    synth.scheduleParameterChange(volume, 1.0f, 0);
+    synth.process(outputs, 2, 256);
+    synth.loadPreset("{\"master_volume\": 0.25}");
+    synth.process(outputs, 2, blockSize);
+    synth.process(outputs, 2, blockSize);
+    if (synth.getParameterValue(volume) != 0.25f) {
+        stats.fail("automation_preset_ramp", "Ramp kept running over the loaded preset value");
+        return false;
+    }
+
+    // off the audio thread, setParameter() and preset loads are queued and
+    // land at the start of the next process()
+    {
+        std::thread ui([&] {
+            synth.setParameter("master_volume", 0.75f);
+            synth.setParameter("mod_2_amount", 0.5f);
+            synth.loadPreset("{\"filter_resonance\": 0.4}");
+        });
+        ui.join();
+        const bool deferred = synth.getParameterValue(volume) == 0.25f && synth.getParameter("mod_2_amount") == 0.0f;
+        synth.process(outputs, 2, 64);
+        if (!deferred || synth.getParameterValue(volume) != 0.75f || synth.getParameter("mod_2_amount") != 0.5f ||
+            std::abs(synth.getParameter("filter_resonance") - 0.4f) > 1.0e-6f) {
+            stats.fail("automation_off_thread", "Off-thread writes not queued to the next process()");
+            return false;
+        }
+    }
+
+    // a producer thread racing the audio thread: events apply in queue
+    // order and the last one wins
+    MotionPureDSP raced;
+    raced.prepare(48000.0, blockSize);
+    raced.setParameterSmoothing(false);
+    startNote(raced);
+    const int cutoff = raced.getParameterIndex("filter_cutoff");
+    raced.setParameterValue(cutoff, 0.0f);
+    const int numEvents = 20000;
+    std::atomic<bool> done { false };
+    std::thread producer([&] {
+        for (int i = 1; i <= numEvents; ++i) {
+            while (!raced.scheduleParameterChange(cutoff, static_cast<float>(i) / numEvents)) {
+                std::this_thread::yield();
+            }
+        }
+        done = true;
+    });
+    bool ordered = true;
+    float last = 0.0f;
+    while (!done) {
+        raced.process(outputs, 2, blockSize);
+        ordered = ordered && raced.getParameterValue(cutoff) >= last;
+        last = raced.getParameterValue(cutoff);
+    }
+    producer.join();
+    raced.process(outputs, 2, blockSize);
+    std::cout << "    Threaded: " << numEvents << " events, final cutoff " << raced.getParameterValue(cutoff) << std::endl;
+    if (!ordered || raced.getParameterValue(cutoff) != 1.0f || !std::isfinite(getPeakLevel(left.data(), blockSize))) {
+        stats.fail("automation_threaded", "Queued events lost or applied out of order");
+        return false;
+    }
+
+    stats.pass("automation_queue");
+    return true;
+}
+
+//==============================================================================
+// Test 19: Index-Resolved Macro Routing
+//==============================================================================
+
+bool testMacroRouting(TestStats& stats) {
+    std::cout << "\n[Test 19] Index-Resolved Macro Routing" << std::endl;
+
+    // two macros on one parameter, one on another, one unknown id
+    MacroSystem macros;
+    macros.addDestination(0, "filter_cutoff", 0.5f, 0.0f, 1.0f);
+    macros.addDestination(1, "filter_cutoff", -0.25f, 0.0f, 0.8f);
+    macros.addDestination(1, "osc1_warp", 1.0f, -1.0f, 1.0f);
+    macros.addDestination(2, "no_such_parameter", 1.0f, 0.0f, 1.0f);
+    macros.setMacroValue(0, 0.8f);
+    macros.setMacroValue(1, 0.4f);
+
+    const int cutoff = MotionPureDSP::getParameterIndex("filter_cutoff");
+    const int warp = MotionPureDSP::getParameterIndex("osc1_warp");
+    const float expectedCutoff = 0.5f * 0.8f * 1.0f - 0.25f * 0.4f * 0.8f;
+    const float expectedWarp = 1.0f * 0.4f * 2.0f;
+
+    int targets[MacroSystem::maxRoutes];
+    float offsets[MacroSystem::maxRoutes];
+    const int numTargets = macros.evaluate(targets, offsets);
+    bool matched = numTargets == 2 && macros.macros[2].numDestinations == 0;
+    for (int t = 0; t < numTargets; ++t) {
+        const float expected = (targets[t] == cutoff) ? expectedCutoff : (targets[t] == warp ? expectedWarp : 1.0e9f);
+        matched = matched && std::abs(offsets[t] - expected) < 1.0e-6f
+                          && offsets[t] == macros.getModulation(targets[t]);
+    }
+    matched = matched && std::abs(macros.applyMacroModulation("filter_cutoff", 0.1f) - (0.1f + expectedCutoff)) < 1.0e-6f;
+    if (!matched) {
+        stats.fail("macro_routes", "Macro offsets differ from amount * value * range");
+        return false;
+    }
+
+    // in the engine: a macro on master volume scales the output, the base
+    // parameter stays where the user set it
+    const int blockSize = 512;
+    std::vector<float> left(blockSize), right(blockSize);
+    float* outputs[2] = { left.data(), right.data() };
+
+    auto renderPeak = [&](float macroValue) {
+        MotionPureDSP synth;
+        synth.prepare(48000.0, blockSize);
+        synth.addMacroDestination(0, "master_volume", 1.0f, 0.0f, 0.85f);
+        synth.setParameter("macro_0_value", macroValue);
+
+        ScheduledEvent event;
+        event.type = ScheduledEvent::NOTE_ON;
+        event.time = 0.0;
+        event.sampleOffset = 0;
+        event.data.note.midiNote = 60;
+        event.data.note.velocity = 0.8f;
+        synth.handleEvent(event);
+
+        float peak = 0.0f;
+        for (int b = 0; b < 16; ++b) {
+            synth.process(outputs, 2, blockSize);
+            peak = std::max(peak, getPeakLevel(left.data(), blockSize));
+        }
+        return std::make_pair(peak, synth.getParameter("master_volume"));
+    };
+
+    const auto off = renderPeak(0.0f);
+    const auto full = renderPeak(1.0f);
+    std::cout << "    Macro 0 -> master volume: peak " << off.first << " at 0, " << full.first << " at 1" << std::endl;
+    if (std::abs(full.first / off.first - 2.0f) > 0.01f || off.second != 0.85f || full.second != 0.85f) {
+        stats.fail("macro_engine", "Macro did not offset master volume");
+        return false;
+    }
+
+    // a knob move updates only its destinations: the incremental path must
+    // land exactly where a full rebuild (prepare) does
+    auto renderAfterMoves = [&](bool movesBeforePrepare) {
+        MotionPureDSP synth;
+        auto applyMoves = [&synth]() {
+            synth.setParameter("macro_1_value", 0.9f);
+            synth.setParameter("filter_resonance", 0.3f);
+            synth.setParameter("amp_env_attack", 0.02f);
+            synth.setParameter("lfo1_rate", 7.0f);
+        };
+
+        synth.addMacroDestination(1, "filter_cutoff", 0.5f, 0.0f, 1.0f);
+        synth.addMacroDestination(1, "osc2_level", -0.4f, 0.0f, 1.0f);
+        if (movesBeforePrepare) applyMoves();
+        synth.prepare(48000.0, blockSize);
+        if (!movesBeforePrepare) applyMoves();
+
+        ScheduledEvent event;
+        event.type = ScheduledEvent::NOTE_ON;
+        event.time = 0.0;
+        event.sampleOffset = 0;
+        event.data.note.midiNote = 57;
+        event.data.note.velocity = 0.8f;
+        synth.handleEvent(event);
+
+        std::vector<float> rendered;
+        for (int b = 0; b < 8; ++b) {
+            synth.process(outputs, 2, blockSize);
+            rendered.insert(rendered.end(), left.begin(), left.end());
+        }
+        return rendered;
+    };
+
+    if (renderAfterMoves(false) != renderAfterMoves(true)) {
+        stats.fail("macro_incremental", "Incremental macro update differs from a full parameter rebuild");
+        return false;
+    }
+
+    {
+        MotionPureDSP synth;
+        synth.prepare(48000.0, blockSize);
+        synth.addMacroDestination(0, "filter_cutoff", 0.5f, 0.0f, 1.0f);
+        const int macroIndex = MotionPureDSP::getParameterIndex("macro_0_value");
+
+        const int moves = 20000;
+        const auto moveStart = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < moves; ++i) {
+            synth.setParameterValue(macroIndex, static_cast<float>(i & 255) / 255.0f);
+        }
+        const auto moveEnd = std::chrono::high_resolution_clock::now();
+        std::printf("    macro knob move (1 destination, 16 voices): %.1f ns\n",
+                    std::chrono::duration<double, std::nano>(moveEnd - moveStart).count() / moves);
+    }
+
+    // cost of a full evaluation: 8 macros x 4 destinations
+    MacroSystem full32;
+    const char* ids[] = { "osc1_level", "osc2_level", "filter_cutoff", "filter_resonance",
+                          "osc1_warp", "osc2_warp", "lfo1_rate", "fm_depth" };
+    for (int m = 0; m < MacroSystem::numMacros; ++m) {
+        for (int d = 0; d < MacroSystem::maxDestinations; ++d) {
+            full32.addDestination(m, ids[(m + d * 3) % 8], 0.1f * (d + 1), 0.0f, 1.0f);
+        }
+    }
+    const int iterations = 200000;
+    volatile float sink = 0.0f;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        full32.setMacroValue(i & 7, static_cast<float>(i & 255) / 255.0f);
+        const int n = full32.evaluate(targets, offsets);
+        sink = sink + offsets[n - 1];
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+
+    std::printf("    32 destinations on %d parameters: %.1f ns per evaluation\n",
+                full32.getNumModulatedParameters(), ns);
+
+    stats.pass("macro_routing");
+    return true;
+}
+
+//==============================================================================
+// Test 20: Unison Oscillator Stacks (Up To 16 Copies)
+//==============================================================================
+
+bool testUnisonOscillator(TestStats& stats) {
+    std::cout << "\n[Test 20] Unison Oscillator Stacks" << std::endl;
+
+    MotionPureDSP synth;
+    synth.prepare(48000.0, 512);
+
+    auto setUnison = [&](float voices1, float voices2, float detune) {
+        synth.setParameter("osc1_unison_voices", voices1);
+        synth.setParameter("osc2_unison_voices", voices2);
+        synth.setParameter("osc1_unison_detune", detune);
+        synth.setParameter("osc2_unison_detune", detune);
+    };
+
+    // lanes and scalar voices run the same kernel per voice, FM carrier included
+    setUnison(7.0f, 16.0f, 0.5f);
+    synth.setParameter("fm_enabled", 1.0f);
+    synth.setParameter("fm_depth", 0.3f);
+
+    constexpr int numSamples = 24000;
+    std::vector<float> outs[2];
+    const VoiceRenderPath paths[2] = { VoiceRenderPath::Scalar, VoiceRenderPath::Lanes };
+    for (int p = 0; p < 2; ++p) {
+        VoiceManager voices;
+        voices.setRenderPath(paths[p]);
+        voices.prepare(48000.0, 512);
+        voices.updateVoiceParameters(synth);
+        for (int v = 0; v < 12; ++v) {
+            voices.handleNoteOn(48 + v * 2, 0.8f);
+        }
+        renderVoices(voices, outs[p], numSamples);
+    }
+
+    const float peak = getPeakLevel(outs[0].data(), numSamples);
+    float maxDiff = 0.0f;
+    for (int i = 0; i < numSamples; ++i) {
+        maxDiff = std::max(maxDiff, std::abs(outs[0][i] - outs[1][i]));
+    }
+
+    std::cout << "    7 + 16 copies, lanes vs scalar: peak " << peak << ", max difference " << maxDiff << std::endl;
+
+    if (peak < 0.001f || maxDiff > peak * 1.0e-4f) {
+        stats.fail("unison_lanes", "Unison output differs between lanes and scalar voices");
+        return false;
+    }
+
+    // spread pans the copies: left and right differ, both render paths
+    // agree, and a centred stack folds back to the mono mix
+    synth.setParameter("osc1_unison_spread", 1.0f);
+    synth.setParameter("osc2_unison_spread", 1.0f);
+    std::vector<float> lefts[2], rights[2];
+    for (int p = 0; p < 2; ++p) {
+        VoiceManager voices;
+        voices.setRenderPath(paths[p]);
+        voices.prepare(48000.0, 512);
+        voices.updateVoiceParameters(synth);
+        for (int v = 0; v < 12; ++v) {
+            voices.handleNoteOn(48 + v * 2, 0.8f);
+        }
+        lefts[p].assign(numSamples, 0.0f);
+        rights[p].assign(numSamples, 0.0f);
+        for (int offset = 0; offset < numSamples; offset += 512) {
+            voices.processBlock(lefts[p].data() + offset, std::min(512, numSamples - offset), 48000.0, rights[p].data() + offset);
+        }
+    }
+
+    float stereoDiff = 0.0f;
+    float sideLevel = 0.0f;
+    for (int i = 0; i < numSamples; ++i) {
+        stereoDiff = std::max(stereoDiff, std::max(std::abs(lefts[0][i] - lefts[1][i]), std::abs(rights[0][i] - rights[1][i])));
+        sideLevel = std::max(sideLevel, std::abs(lefts[0][i] - rights[0][i]));
+    }
+
+    synth.setParameter("osc1_unison_spread", 0.0f);
+    synth.setParameter("osc2_unison_spread", 0.0f);
+    MotionPureDSP centred;
+    centred.prepare(48000.0, 512);
+    centred.setParameter("osc1_unison_voices", 16.0f);
+    std::vector<float> centredLeft(512), centredRight(512);
+    float* centredOutputs[2] = { centredLeft.data(), centredRight.data() };
+    ScheduledEvent noteOn;
+    noteOn.type = ScheduledEvent::NOTE_ON;
+    noteOn.data.note.midiNote = 57;
+    noteOn.data.note.velocity = 0.8f;
+    centred.handleEvent(noteOn);
+    centred.process(centredOutputs, 2, 512);
+
+    std::cout << "    Spread 1: side peak " << sideLevel << ", lanes vs scalar max difference " << stereoDiff << std::endl;
+
+    if (sideLevel < peak * 0.05f || stereoDiff > peak * 1.0e-4f || centredLeft != centredRight ||
+        getPeakLevel(centredLeft.data(), 512) < 0.001f) {
+        stats.fail("unison_spread", "Unison spread is not stereo, or differs between render paths");
+        return false;
+    }
+
+    // 1/sqrt(n) keeps a detuned stack about as loud as one oscillator
+    synth.setParameter("fm_enabled", 0.0f);
+    auto renderRms = [&](float copies) {
+        setUnison(copies, copies, 1.0f);
+        VoiceManager voices;
+        voices.prepare(48000.0, 512);
+        voices.updateVoiceParameters(synth);
+        voices.handleNoteOn(57, 0.8f);
+
+        std::vector<float> out;
+        renderVoices(voices, out, numSamples);
+        double sum = 0.0;
+        for (int i = numSamples / 2; i < numSamples; ++i) sum += out[i] * out[i];
+        return std::sqrt(sum / (numSamples / 2));
+    };
+
+    const double rms1 = renderRms(1.0f);
+    const double rms16 = renderRms(16.0f);
+    std::cout << "    RMS: 1 copy " << rms1 << ", 16 copies " << rms16 << std::endl;
+
+    if (rms16 < rms1 * 0.5 || rms16 > rms1 * 2.0) {
+        stats.fail("unison_level", "Unison level is not normalised");
+        return false;
+    }
+
+    // CPU: 16 voices with both oscillators stacked, PolyBLEP then wavetable
+    const int counts[] = { 1, 2, 4, 8, 16 };
+    const char* engineNames[] = { "PolyBLEP", "Wavetable" };
+    for (int e = 0; e < 2; ++e) {
+        synth.setParameter("osc_engine", static_cast<float>(e));
+
+        double ns[5] = {};
+        for (int c = 0; c < 5; ++c) {
+            setUnison(static_cast<float>(counts[c]), static_cast<float>(counts[c]), 0.5f);
+
+            VoiceManager voices;
+            voices.prepare(48000.0, 512);
+            voices.updateVoiceParameters(synth);
+            for (int v = 0; v < 16; ++v) {
+                voices.handleNoteOn(40 + v * 3, 0.8f);
+            }
+
+            measureNsPerVoiceSample(voices, 16, 0.2);  // warm-up
+            ns[c] = measureNsPerVoiceSample(voices, 16, 2.0);
+            std::printf("    %-9s %2d copies per oscillator: %6.2f ns per voice-sample\n", engineNames[e], counts[c], ns[c]);
+        }
+
+        // 8x the copies from 2 to 16, one more vector block
+        if (ns[4] > ns[1] * 4.0) {
+            stats.fail("unison_cost", std::string(engineNames[e]) + " unison cost grows linearly with the copy count");
+            return false;
+        }
+    }
+    synth.setParameter("osc_engine", 0.0f);
+
+    stats.pass("unison_oscillator");
+    return true;
+}
+
 //==============================================================================
 // Main Test Runner
 //==============================================================================
@@ -391,6 +1746,19 @@ int main(int argc, char* argv[]) {
     testFilterTypes(stats);
     testSampleRates(stats);
     testStereoWidth(stats);
+    testLaneRendererMatchesScalar(stats);
+    testLaneRendererThroughput(stats);
+    testConfigurablePolyphony(stats);
+    testVoiceStealing(stats);
+    testHostBlockSizes(stats);
+    testWavetableEngine(stats);
+    testModulationMatrix(stats);
+    testSegmentEnvelope(stats);
+    testFilterModulation(stats);
+    testParameterRegistry(stats);
+    testAutomationQueue(stats);
+    testMacroRouting(stats);
+    testUnisonOscillator(stats);
 
     stats.printSummary();
 
@@ -11,6 +11,7 @@
 //==============================================================================
 BreathLeadPlugin::BreathLeadPlugin()
     : juce::AudioProcessor(BusesProperties()
+                                .withInput("Breath", juce::AudioChannelSet::mono(), false)
                                 .withOutput("Output", juce::AudioChannelSet::stereo()))
 {
     // Create parameter layout
@@ -21,23 +22,78 @@ BreathLeadPlugin::BreathLeadPlugin()
         *this, nullptr, "BreathLeadParameters", std::move(layout)
     );
 
+    breathInputParam_ = parameters_->getRawParameterValue(BreathLeadParamIDs::breathInput);
+    breathGainParam_ = parameters_->getRawParameterValue(BreathLeadParamIDs::breathInputGainDb);
+    voiceModeParam_ = parameters_->getRawParameterValue(BreathLeadParamIDs::voiceMode);
+
     // Create synth
-    synth_ = std::make_unique<BreathLeadSynth>(*parameters_);
+    synth_ = std::make_unique<BreathLeadSynth>(*parameters_, requestedVoiceMode());
+
+    parameters_->addParameterListener(BreathLeadParamIDs::voiceMode, this);
 }
 
 BreathLeadPlugin::~BreathLeadPlugin()
 {
-    // Cleanup handled by unique_ptr
+    parameters_->removeParameterListener(BreathLeadParamIDs::voiceMode, this);
+    cancelPendingUpdate();
 }
 
+//==============================================================================
+// Voice Mode
+//==============================================================================
+
+BreathLeadSynth::VoiceMode BreathLeadPlugin::requestedVoiceMode() const
+{
+    return static_cast<BreathLeadSynth::VoiceMode>(juce::roundToInt(voiceModeParam_->load()));
+}
+
+std::unique_ptr<BreathLeadSynth> BreathLeadPlugin::makePreparedSynth() const
+{
+    auto synth = std::make_unique<BreathLeadSynth>(*parameters_, requestedVoiceMode());
+
+    if (preparedSampleRate_ > 0.0)
+        synth->prepare(preparedSampleRate_, preparedBlockSize_, getTotalNumOutputChannels());
+
+    return synth;
+}
+
+void BreathLeadPlugin::parameterChanged(const juce::String&, float)
+{
+    // may arrive on the audio thread; the rebuild allocates
+    triggerAsyncUpdate();
+}
+
+void BreathLeadPlugin::handleAsyncUpdate()
+{
+    if (synth_->getVoiceMode() == requestedVoiceMode())
+        return;
+
+    // build and prepare off the callback, then swap while it is held off
+    auto synth = makePreparedSynth();
+
+    suspendProcessing(true);
+    std::swap(synth_, synth);
+    suspendProcessing(false);
+}   // the old synth is released here, outside the callback lock
+
 //==============================================================================
 // AudioProcessor Interface
 //==============================================================================
 
 void BreathLeadPlugin::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    // Prepare synth
-    synth_->prepare(sampleRate, samplesPerBlock, getTotalNumOutputChannels());
+    preparedSampleRate_ = sampleRate;
+    preparedBlockSize_ = samplesPerBlock;
+
+    // Prepare synth (picking up a voice mode restored while stopped)
+    if (synth_->getVoiceMode() != requestedVoiceMode())
+        synth_ = makePreparedSynth();
+    else
+        synth_->prepare(sampleRate, samplesPerBlock, getTotalNumOutputChannels());
+
+    breathFollower_.prepare(sampleRate);
+    // the only allocation; processBlock chunks anything larger
+    breathPressure_.assign(static_cast<std::size_t>(std::max(1, samplesPerBlock)), 0.0f);
 }
 
 void BreathLeadPlugin::releaseResources()
@@ -49,11 +105,36 @@ void BreathLeadPlugin::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
 {
     juce::ScopedNoDenormals noDenormals;
 
-    // Clear output buffer
-    buffer.clear();
+    const int numSamples = buffer.getNumSamples();
+    const bool breathOn = breathInputParam_->load() > 0.5f && getTotalNumInputChannels() > 0
+                       && ! breathPressure_.empty();   // empty until prepareToPlay
+
+    if (! breathOn)
+    {
+        breathFollower_.reset();
+        buffer.clear();
+        synth_->setBreathPressure(nullptr);
+        synth_->renderNextBlock(buffer, midiMessages, 0, numSamples);
+        return;
+    }
+
+    // Breath mode: follow the input bus (first channel) before it is cleared;
+    // the pressure stays sample-aligned, no added latency. Blocks larger than
+    // the prepared size run in chunks rather than growing the buffer here.
+    breathFollower_.setInputGainDb(breathGainParam_->load());
 
-    // Render synth with MIDI
-    synth_->renderNextBlock(buffer, midiMessages, 0, buffer.getNumSamples());
+    const int chunkSize = static_cast<int>(breathPressure_.size());
+
+    for (int start = 0; start < numSamples; start += chunkSize)
+    {
+        const int n = std::min(chunkSize, numSamples - start);
+
+        breathFollower_.process(buffer.getReadPointer(0, start), breathPressure_.data(), n);
+        buffer.clear(start, n);
+
+        synth_->setBreathPressure(breathPressure_.data(), start);
+        synth_->renderNextBlock(buffer, midiMessages, start, n);
+    }
 }
 
 void BreathLeadPlugin::processBlockBypassed(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
@@ -64,6 +145,18 @@ void BreathLeadPlugin::processBlockBypassed(juce::AudioBuffer<float>& buffer, ju
     buffer.clear();
 }
 
+bool BreathLeadPlugin::isBusesLayoutSupported(const BusesLayout& layouts) const
+{
+    const auto out = layouts.getMainOutputChannelSet();
+    if (out != juce::AudioChannelSet::stereo() && out != juce::AudioChannelSet::mono())
+        return false;
+
+    const auto in = layouts.getMainInputChannelSet();
+    return in == juce::AudioChannelSet::disabled()
+        || in == juce::AudioChannelSet::mono()
+        || in == juce::AudioChannelSet::stereo();
+}
+
 juce::AudioProcessorEditor* BreathLeadPlugin::createEditor()
 {
     // For now, return generic editor (can be replaced with custom UI later)
@@ -90,6 +183,25 @@ void BreathLeadPlugin::setStateInformation(const void* data, int sizeInBytes)
         parameters_->state = newTree;
 }
 
+bool BreathLeadPlugin::applyPreset(const juce::XmlElement& preset)
+{
+    if (! preset.hasTagName("PRESET") || preset.getStringAttribute("plugin") != "BreathLead")
+        return false;
+
+    auto* values = preset.getChildByName("VALUES");
+    if (values == nullptr)
+        return false;
+
+    for (auto* param : values->getChildWithTagNameIterator("PARAM"))
+    {
+        // ranged parameter: preset values are plain, the host side is 0..1
+        if (auto* p = parameters_->getParameter(param->getStringAttribute("id")))
+            p->setValueNotifyingHost(p->convertTo0to1((float) param->getDoubleAttribute("value")));
+    }
+
+    return true;
+}
+
 //==============================================================================
 // Channel Names
 //==============================================================================
@@ -7,9 +7,13 @@
  */
 
 #include "dsp/BreathLeadDSP.h"
+#include "BreathLeadParams.h"
+#include "dsp/FastMath.h"
 #include <algorithm>
 #include <cmath>
 
+namespace FastMath = SchillingerEcosystem::DSP::FastMath;
+
 static inline float dbToLin(float db) { return std::pow(10.0f, db / 20.0f); }
 
 float BreathLeadDSP::coeffFromMs (float ms) const
@@ -23,39 +27,69 @@ float BreathLeadDSP::midiToHzClamp (float hz) const
     return std::clamp(hz, 20.0f, 12000.0f);
 }
 
-void BreathLeadDSP::prepare (double sampleRate, int samplesPerBlock, int numChannels)
+// Same bilinear designs as juce::dsp::IIR::Coefficients::makeHighPass/makeLowPass
+// with Q = 1/sqrt2, normalised so a0 = 1.
+RampedBiquad::Coeffs RampedBiquad::makeHighPass (double sampleRate, float hz)
 {
-    sr = sampleRate;
+    const float n = 1.0f / std::tan(juce::MathConstants<float>::pi * hz / (float) sampleRate);
+    const float n2 = n * n;
+    const float invQ = juce::MathConstants<float>::sqrt2;
+    const float c1 = 1.0f / (1.0f + invQ * n + n2);
+
+    Coeffs c;
+    c.b0 = c1 * n2;
+    c.b1 = -2.0f * c1 * n2;
+    c.b2 = c1 * n2;
+    c.a1 = c1 * 2.0f * (n2 - 1.0f);
+    c.a2 = c1 * (1.0f - invQ * n + n2);
+    return c;
+}
 
-    juce::dsp::ProcessSpec spec;
-    spec.sampleRate = sr;
-    spec.maximumBlockSize = (juce::uint32) samplesPerBlock;
-    spec.numChannels = (juce::uint32) std::max(1, numChannels);
+RampedBiquad::Coeffs RampedBiquad::makeLowPass (double sampleRate, float hz)
+{
+    const float n = 1.0f / std::tan(juce::MathConstants<float>::pi * hz / (float) sampleRate);
+    const float n2 = n * n;
+    const float invQ = juce::MathConstants<float>::sqrt2;
+    const float c1 = 1.0f / (1.0f + invQ * n + n2);
+
+    Coeffs c;
+    c.b0 = c1;
+    c.b1 = 2.0f * c1;
+    c.b2 = c1;
+    c.a1 = c1 * 2.0f * (1.0f - n2);
+    c.a2 = c1 * (1.0f - invQ * n + n2);
+    return c;
+}
 
-    pitchBP.reset(); form1BP.reset(); form2BP.reset();
-    pitchBP.prepare(spec); form1BP.prepare(spec); form2BP.prepare(spec);
+void BreathLeadDSP::prepare (double sampleRate, int samplesPerBlock, int numChannels)
+{
+    sr = sampleRate;
 
-    pitchBP.setType(juce::dsp::StateVariableTPTFilterType::bandpass);
-    form1BP.setType(juce::dsp::StateVariableTPTFilterType::bandpass);
-    form2BP.setType(juce::dsp::StateVariableTPTFilterType::bandpass);
+    // mono voice, rendered in internal chunks: nothing here depends on block size or channels
+    juce::ignoreUnused(samplesPerBlock, numChannels);
 
-    hp.reset(); lp.reset();
-    hp.prepare(spec); lp.prepare(spec);
+    // mix: pitch core + formant body
+    resonators.setWeight(ResonatorBank::pitch, 0.70f);
+    resonators.setWeight(ResonatorBank::formant1, 0.40f);
+    resonators.setWeight(ResonatorBank::formant2, 0.30f);
+    resonators.setWeight(ResonatorBank::formant3, 0.0f);
 
-    // init with safe coefficients; will be updated by setParams
-    hp.coefficients = juce::dsp::IIR::Coefficients<float>::makeHighPass(sr, 60.0);
-    lp.coefficients = juce::dsp::IIR::Coefficients<float>::makeLowPass(sr, 14000.0);
+    // init with safe coefficients; retuned at control rate inside render
+    hp.setCoeffs(RampedBiquad::makeHighPass(sr, 60.0f));
+    lp.setCoeffs(RampedBiquad::makeLowPass(sr, 14000.0f));
 
     noise.reset(0x12345678u);
 
     meMW.prepare(sr); meAT.prepare(sr); mePB.prepare(sr); mePitch.prepare(sr);
     meMW.reset(); meAT.reset(); mePB.reset(); mePitch.reset();
 
-    airS.reset(sr, 0.02); toneS.reset(sr, 0.02); formantS.reset(sr, 0.02); resistS.reset(sr, 0.02);
-    vibrDepthS.reset(sr, 0.05); vibrRateS.reset(sr, 0.05);
-    noiseColorS.reset(sr, 0.05); sineAnchorS.reset(sr, 0.05);
-    motionSensS.reset(sr, 0.05);
-    outGainS.reset(sr, 0.05);
+    for (int p : { smAir, smTone, smFormant, smResist })
+        smoothers.reset(p, sr, 0.02);
+    for (int p : { smVibrDepth, smVibrRate, smNoiseColor, smSineAnchor, smMotionSens, smOutGain })
+        smoothers.reset(p, sr, 0.05);
+
+    // controllers ramp per update; expression idles at full scale (CC11 = 127)
+    smoothers.setCurrentAndTarget(smExpression, 1.0f);
 
     reset();
 }
@@ -64,21 +98,94 @@ void BreathLeadDSP::reset()
 {
     gate = false;
     phase = 0.0f;
+    oscPhase = 0.0f;
     env = 0.0f;
 
-    pitchBP.reset(); form1BP.reset(); form2BP.reset();
+    resonators.reset();
     hp.reset(); lp.reset();
 
     meMW.reset(); meAT.reset(); mePB.reset(); mePitch.reset();
+
+    // next render snaps filters to the current targets instead of ramping
+    controlCountdown = 0;
+    coeffsValid = false;
+
+    asleep = true;
+    quietSamples = 0;
+    releasedSamples = 0;
+}
+
+void BreathLeadDSP::setControlInterval (int numSamples)
+{
+    controlInterval = std::clamp(numSamples, 1, maxControlInterval);
+    controlCountdown = std::min(controlCountdown, controlInterval);
+}
+
+void BreathLeadDSP::updateControlRate (float hz, float tone, float form, float resistanceMix)
+{
+    // Pitch bandpass
+    resonators.setBand(ResonatorBank::pitch, sr, hz, 0.7f + 0.25f * resistanceMix); // not whistly
+
+    // Formant centers: morph between "A" and "E"-ish regions (rough but musical)
+    // Use pitch-relative body so it tracks as you play
+    const float f1A = 750.0f,  f2A = 1200.0f;
+    const float f1E = 450.0f,  f2E = 2000.0f;
+    float f1 = (1.0f - form) * f1A + form * f1E;
+    float f2 = (1.0f - form) * f2A + form * f2E;
+
+    // subtle tracking: higher notes lift formants a bit
+    const float track = std::clamp(FastMath::log2(hz / 220.0f) * 0.08f, -0.12f, 0.18f);
+    const float trackMul = FastMath::exp2(track);
+    f1 *= trackMul;
+    f2 *= trackMul;
+
+    resonators.setBand(ResonatorBank::formant1, sr, std::clamp(f1, 120.0f, 6000.0f), 0.55f + 0.25f * resistanceMix);
+    resonators.setBand(ResonatorBank::formant2, sr, std::clamp(f2, 200.0f, 8000.0f), 0.45f + 0.20f * resistanceMix);
+
+    // --- Tone tilt ---
+    // tone=0 dark, tone=1 bright
+    const float hpHz = 40.0f + (1.0f - tone) * 120.0f;     // darker = more low cleanup
+    const float lpHz = 4500.0f + tone * 11500.0f;          // brighter = higher LP
+
+    const auto hpC = RampedBiquad::makeHighPass(sr, hpHz);
+    const auto lpC = RampedBiquad::makeLowPass(sr, lpHz);
+
+    if (coeffsValid)
+    {
+        hp.rampTo(hpC, controlInterval);
+        lp.rampTo(lpC, controlInterval);
+    }
+    else
+    {
+        hp.setCoeffs(hpC);
+        lp.setCoeffs(lpC);
+        coeffsValid = true;
+    }
 }
 
 void BreathLeadDSP::setPitchHz (float hz)      { pitchHz = midiToHzClamp(hz); }
-void BreathLeadDSP::setGate (bool isOn)        { gate = isOn; }
+void BreathLeadDSP::setGate (bool isOn)
+{
+    if (isOn && asleep)
+        wake();
+
+    if (gate && ! isOn)
+        releasedSamples = 0;
+
+    gate = isOn;
+}
+
 void BreathLeadDSP::setVelocity (float vel01)  { velocity = std::clamp(vel01, 0.0f, 1.0f); }
-void BreathLeadDSP::setModWheel (float mw01)   { modWheel = std::clamp(mw01, 0.0f, 1.0f); }
+void BreathLeadDSP::setModWheel (float mw01)   { setController(BreathController::modWheel, mw01); }
 void BreathLeadDSP::setAftertouch (float at01) { aftertouch = std::clamp(at01, 0.0f, 1.0f); }
 void BreathLeadDSP::setPitchBendNorm (float pbNorm) { pitchBend = std::clamp(pbNorm, -1.0f, 1.0f); }
 
+void BreathLeadDSP::setController (BreathController controller, float value01, int rampSamples)
+{
+    static constexpr int index[] = { smModWheel, smBreath, smExpression };
+    smoothers.setTarget(index[(int) controller], std::clamp(value01, 0.0f, 1.0f), rampSamples);
+}
+
 void BreathLeadDSP::setParams (float air, float tone, float formant, float resistance,
                                float vibrDepth, float vibrRateHz,
                                float noiseColor, float sineAnchor,
@@ -86,93 +193,256 @@ void BreathLeadDSP::setParams (float air, float tone, float formant, float resis
                                float attackMs, float releaseMs,
                                float outputGainDb)
 {
-    airS.setTargetValue(std::clamp(air, 0.0f, 1.0f));
-    toneS.setTargetValue(std::clamp(tone, 0.0f, 1.0f));
-    formantS.setTargetValue(std::clamp(formant, 0.0f, 1.0f));
-    resistS.setTargetValue(std::clamp(resistance, 0.0f, 1.0f));
+    const float values[] = { air, tone, formant, resistance,
+                             vibrDepth, vibrRateHz,
+                             noiseColor, sineAnchor,
+                             motionSustain ? 1.0f : 0.0f, motionSensitivity,
+                             attackMs, releaseMs,
+                             outputGainDb };
+
+    for (int i = 0; i < (int) BreathLeadParam::numParams; ++i)
+        setParam((BreathLeadParam) i, values[i]);
+}
+
+void BreathLeadDSP::setParam (BreathLeadParam param, float value)
+{
+    switch (param)
+    {
+        case BreathLeadParam::air:               smoothers.setTarget(smAir, std::clamp(value, 0.0f, 1.0f)); break;
+        case BreathLeadParam::tone:              smoothers.setTarget(smTone, std::clamp(value, 0.0f, 1.0f)); break;
+        case BreathLeadParam::formant:           smoothers.setTarget(smFormant, std::clamp(value, 0.0f, 1.0f)); break;
+        case BreathLeadParam::resistance:        smoothers.setTarget(smResist, std::clamp(value, 0.0f, 1.0f)); break;
 
-    vibrDepthS.setTargetValue(std::clamp(vibrDepth, 0.0f, 1.0f));
-    vibrRateS.setTargetValue(std::clamp(vibrRateHz, 0.5f, 8.0f));
+        case BreathLeadParam::vibratoDepth:      smoothers.setTarget(smVibrDepth, std::clamp(value, 0.0f, 1.0f)); break;
+        case BreathLeadParam::vibratoRateHz:     smoothers.setTarget(smVibrRate, std::clamp(value, 0.5f, 8.0f)); break;
 
-    noiseColorS.setTargetValue(std::clamp(noiseColor, 0.0f, 1.0f));
-    sineAnchorS.setTargetValue(std::clamp(sineAnchor, 0.0f, 1.0f));
+        case BreathLeadParam::noiseColor:        smoothers.setTarget(smNoiseColor, std::clamp(value, 0.0f, 1.0f)); break;
+        case BreathLeadParam::sineAnchor:        smoothers.setTarget(smSineAnchor, std::clamp(value, 0.0f, 1.0f)); break;
 
-    motionSustainEnabled = motionSustain;
-    motionSensS.setTargetValue(std::clamp(motionSensitivity, 0.0f, 1.0f));
+        case BreathLeadParam::motionSustain:     motionSustainEnabled = value > 0.5f; break;
+        case BreathLeadParam::motionSensitivity: smoothers.setTarget(smMotionSens, std::clamp(value, 0.0f, 1.0f)); break;
 
-    envA = coeffFromMs(std::max(1.0f, attackMs));
-    envR = coeffFromMs(std::max(5.0f, releaseMs));
+        case BreathLeadParam::attackMs:          envA = coeffFromMs(std::max(1.0f, value)); break;
+        case BreathLeadParam::releaseMs:         envR = coeffFromMs(std::max(5.0f, value)); break;
 
-    outGainS.setTargetValue(dbToLin(outputGainDb));
+        case BreathLeadParam::outputGainDb:      smoothers.setTarget(smOutGain, dbToLin(value)); break;
+
+        case BreathLeadParam::numParams:         break;
+    }
+}
+
+int BreathLeadDSP::getTailLengthSamples() const
+{
+    // env follows envR^n from at most 1, so it reaches the floor after log(floor) / log(envR)
+    const double releaseSamples = std::log((double) silenceThreshold) / std::log(std::max((double) envR, 1.0e-6));
+    return (int) std::ceil(releaseSamples + resonatorRingMs * 0.001 * sr);
+}
+
+void BreathLeadDSP::wake()
+{
+    asleep = false;
+    quietSamples = 0;
+    releasedSamples = 0;
+
+    // parameter moves made while asleep take effect at once, not as a ramp
+    smoothers.snapAllToTarget();
+}
+
+void BreathLeadDSP::sleep()
+{
+    asleep = true;
+    env = 0.0f;
+
+    resonators.reset();
+    hp.reset(); lp.reset();
+
+    controlCountdown = 0;
+    coeffsValid = false;
+}
+
+void BreathLeadDSP::updateIdleState (int numSamples, float peak)
+{
+    if (gate)
+        return;
+
+    releasedSamples += numSamples;
+    quietSamples = (peak < silenceThreshold) ? quietSamples + numSamples : 0;
+
+    const int holdSamples = (int) (silenceHoldMs * 0.001 * sr);
+    if (quietSamples >= holdSamples || releasedSamples >= getTailLengthSamples())
+        sleep();
 }
 
 void BreathLeadDSP::render (juce::AudioBuffer<float>& out, int startSample, int numSamples)
 {
-    const int chs = out.getNumChannels();
-    auto* ch0 = out.getWritePointer(0);
+    renderBlock(out, startSample, numSamples, nullptr);
+}
 
-    for (int i = 0; i < numSamples; ++i)
+void BreathLeadDSP::renderBlock (juce::AudioBuffer<float>& out, int startSample, int numSamples,
+                                 const float* pitchHzBlock, const float* pressureBlock)
+{
+    if (asleep)
     {
-        // smooth params
-        const float air = airS.getNextValue();
-        const float tone = toneS.getNextValue();
-        const float form = formantS.getNextValue();
-        const float resist = resistS.getNextValue();
-        const float vibrDepth = vibrDepthS.getNextValue();
-        const float vibrRate = vibrRateS.getNextValue();
-        const float noiseColor = noiseColorS.getNextValue();
-        const float sineAnchor = sineAnchorS.getNextValue();
-        const float motionSens = motionSensS.getNextValue();
-        const float outGain = outGainS.getNextValue();
-
-        // vibrato (slow; depth small)
-        const float vibr = std::sin(phase * 2.0f * juce::MathConstants<float>::pi) * vibrDepth;
-        const float vibRateNorm = vibrRate / (float) sr;
-        phase += vibRateNorm;
-        if (phase >= 1.0f) phase -= 1.0f;
-
-        // pitch with vibrato + pitchbend (±2 semitones typical)
-        const float bendSemis = 2.0f * pitchBend;
-        const float pitchMul = std::pow(2.0f, (bendSemis + vibr * 0.35f) / 12.0f);
-        const float hz = midiToHzClamp(pitchHz * pitchMul);
-
-        // --- Motion energy (optional) ---
-        float motionE = 0.0f;
-        if (motionSustainEnabled)
+        if (pitchHzBlock != nullptr && numSamples > 0)
+            pitchHz = midiToHzClamp(pitchHzBlock[numSamples - 1]);
+        return;
+    }
+
+    while (numSamples > 0 && ! asleep)
+    {
+        const int n = std::min(numSamples, maxChunkSize);
+        renderChunk(out, startSample, n, pitchHzBlock, pressureBlock);
+
+        startSample += n;
+        numSamples -= n;
+        if (pitchHzBlock != nullptr)
+            pitchHzBlock += n;
+        if (pressureBlock != nullptr)
+            pressureBlock += n;
+    }
+}
+
+void BreathLeadDSP::renderChunk (juce::AudioBuffer<float>& out, int startSample, int numSamples,
+                                 const float* pitchHzBlock, const float* pressureBlock)
+{
+    jassert(numSamples <= maxChunkSize);
+
+    // --- Pass 1: pitch track ---
+    // vibrato (slow; depth small) + pitchbend (±2 semitones typical)
+    const float bendSemis = 2.0f * pitchBend;
+    const float invSr = 1.0f / (float) sr;
+
+    smoothers.advance(numSamples);
+
+    if (smoothers.isAnyMoving((1u << smVibrDepth) | (1u << smVibrRate)))
+    {
+        const float* vibrDepth = smoothers.getRamp(smVibrDepth, numSamples);
+        const float* vibrRate = smoothers.getRamp(smVibrRate, numSamples);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float vibr = FastMath::sin2Pi(phase) * vibrDepth[i];
+            phase += vibrRate[i] * invSr;
+            if (phase >= 1.0f) phase -= 1.0f;
+
+            hzScratch[i] = bendSemis + vibr * 0.35f;
+        }
+    }
+    else
+    {
+        const float vibrDepth = smoothers.getCurrent(smVibrDepth);
+        const float phaseInc = smoothers.getCurrent(smVibrRate) * invSr;
+
+        for (int i = 0; i < numSamples; ++i)
         {
-            // feed derivatives of expressive controls; summed then softened
-            const float eMW = meMW.process(modWheel, motionSens);
-            const float eAT = meAT.process(aftertouch, motionSens);
-            const float ePB = mePB.process(pitchBend, motionSens);
-            const float eP  = mePitch.process(hz / 2000.0f, motionSens); // scaled pitch motion cue
-            motionE = std::min(1.0f, (eMW + eAT + ePB + 0.5f * eP));
+            const float vibr = FastMath::sin2Pi(phase) * vibrDepth;
+            phase += phaseInc;
+            if (phase >= 1.0f) phase -= 1.0f;
+
+            hzScratch[i] = bendSemis + vibr * 0.35f;
         }
+    }
+
+    FastMath::semitonesToRatioBlock(hzScratch, hzScratch, numSamples);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float base = (pitchHzBlock != nullptr) ? midiToHzClamp(pitchHzBlock[i]) : pitchHz;
+        hzScratch[i] = midiToHzClamp(base * hzScratch[i]);
+    }
+
+    if (pitchHzBlock != nullptr)
+        pitchHz = midiToHzClamp(pitchHzBlock[numSamples - 1]);
+
+    renderMotion(numSamples);
+    renderNoise(numSamples);
+
+    // --- Pass 2: voice ---
+    // settled parameters are loop constants; the ramping loop only runs while one moves
+    if (smoothers.isAnyMoving(voiceParamMask))
+        renderVoice<true>(numSamples, pressureBlock);
+    else
+        renderVoice<false>(numSamples, pressureBlock);
+
+    float peak = 0.0f;
+    for (int i = 0; i < numSamples; ++i)
+        peak = std::max(peak, std::abs(monoScratch[i]));
+
+    updateIdleState(numSamples, peak);
+
+    // --- Pass 3: write to all channels mono (or widen later) ---
+    for (int c = 0; c < out.getNumChannels(); ++c)
+    {
+        auto* dst = out.getWritePointer(c, startSample);
+        for (int i = 0; i < numSamples; ++i)
+            dst[i] += monoScratch[i];
+    }
+}
+
+template <bool Ramping>
+void BreathLeadDSP::renderVoice (int numSamples, const float* pressureBlock)
+{
+    const float* ramp[numSmoothed] {};
+    float value[numSmoothed];
+
+    for (int p = 0; p < numSmoothed; ++p)
+    {
+        value[p] = smoothers.getCurrent(p);
+        if constexpr (Ramping)
+            if ((voiceParamMask >> p) & 1u)
+                ramp[p] = smoothers.getRamp(p, numSamples);
+    }
+
+    auto param = [&] (int p, int i)
+    {
+        if constexpr (Ramping)
+            return ramp[p][i];
+        else
+            return value[p];
+    };
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        // smooth params
+        const float air = param(smAir, i);
+        const float tone = param(smTone, i);
+        const float form = param(smFormant, i);
+        const float resist = param(smResist, i);
+        const float sineAnchor = param(smSineAnchor, i);
+        const float outGain = param(smOutGain, i) * param(smExpression, i);
+
+        const float hz = hzScratch[i];
+        const float motionE = motionScratch[i];
 
         // Air envelope: note-on gives initial energy, modWheel sustains
         // Pressure target combines: base air + wheel + motion
         float pressureTarget = 0.0f;
-        if (gate)
+        if (gate && pressureBlock != nullptr)
+        {
+            // breath input replaces velocity + wheel
+            pressureTarget = std::clamp(pressureBlock[i] + motionE * 0.60f, 0.0f, 1.0f);
+        }
+        else if (gate)
         {
             // velocity grants immediate "speak"
             const float velSpeak = 0.20f + 0.80f * velocity;
-            const float wheelPressure = modWheel;  // CC1 sustains
+            const float wheelPressure = std::max(param(smModWheel, i), param(smBreath, i)); // CC1 / CC2 sustain
             const float motionPressure = motionE;  // motion sustains (if enabled)
             pressureTarget = std::clamp(velSpeak * 0.55f + wheelPressure * 0.75f + motionPressure * 0.60f, 0.0f, 1.0f);
         }
 
-        const float coeff = (pressureTarget > env) ? envA : envR;
+        // breath is already enveloped by its follower: track it directly while the note is held
+        const float coeff = (gate && pressureBlock != nullptr) ? 0.0f
+                          : (pressureTarget > env) ? envA : envR;
         env = pressureTarget + coeff * (env - pressureTarget);
 
         // Excitation signal
-        const float w = noise.nextWhite();
-        const float p = noise.nextPink();
-        const float n = (1.0f - noiseColor) * w + noiseColor * p;
+        const float n = noiseScratch[i];
 
         // tiny sine anchor at pitch (not a "synth osc", just intonation glue)
-        static float oscPhase = 0.0f;
         oscPhase += (hz / (float) sr);
         if (oscPhase >= 1.0f) oscPhase -= 1.0f;
-        const float sine = std::sin(oscPhase * 2.0f * juce::MathConstants<float>::pi);
+        const float sine = FastMath::sin2Pi(oscPhase);
 
         // resistance: higher resistance = tighter / brighter resonance, less raw noise
         const float resistanceMix = std::clamp(resist, 0.0f, 1.0f);
@@ -182,43 +452,15 @@ void BreathLeadDSP::render (juce::AudioBuffer<float>& out, int startSample, int
         float x = excitation * drive;
 
         // --- Resonance stage ---
-        // Pitch bandpass
-        pitchBP.setCutoffFrequency(hz);
-        pitchBP.setResonance(0.7f + 0.25f * resistanceMix); // not whistly
-
-        // Formant centers: morph between "A" and "E"-ish regions (rough but musical)
-        // Use pitch-relative body so it tracks as you play
-        const float f1A = 750.0f,  f2A = 1200.0f;
-        const float f1E = 450.0f,  f2E = 2000.0f;
-        float f1 = (1.0f - form) * f1A + form * f1E;
-        float f2 = (1.0f - form) * f2A + form * f2E;
-
-        // subtle tracking: higher notes lift formants a bit
-        const float track = std::clamp(std::log2(hz / 220.0f) * 0.08f, -0.12f, 0.18f);
-        f1 *= std::pow(2.0f, track);
-        f2 *= std::pow(2.0f, track);
-
-        form1BP.setCutoffFrequency(std::clamp(f1, 120.0f, 6000.0f));
-        form2BP.setCutoffFrequency(std::clamp(f2, 200.0f, 8000.0f));
-
-        form1BP.setResonance(0.55f + 0.25f * resistanceMix);
-        form2BP.setResonance(0.45f + 0.20f * resistanceMix);
-
-        // process sample through filters (channel 0 for mono)
-        auto yPitch = pitchBP.processSample(0, x);
-        auto yF1    = form1BP.processSample(0, x);
-        auto yF2    = form2BP.processSample(0, x);
-
-        // mix: pitch core + formant body
-        float y = 0.70f * yPitch + 0.40f * yF1 + 0.30f * yF2;
-
-        // --- Tone tilt ---
-        // tone=0 dark, tone=1 bright
-        const float hpHz = 40.0f + (1.0f - tone) * 120.0f;     // darker = more low cleanup
-        const float lpHz = 4500.0f + tone * 11500.0f;          // brighter = higher LP
+        // Filter tuning runs at control rate; biquads ramp in between
+        if (--controlCountdown < 0)
+        {
+            updateControlRate(hz, tone, form, resistanceMix);
+            controlCountdown = controlInterval - 1;
+        }
 
-        hp.coefficients = juce::dsp::IIR::Coefficients<float>::makeHighPass(sr, hpHz);
-        lp.coefficients = juce::dsp::IIR::Coefficients<float>::makeLowPass(sr, lpHz);
+        // pitch core + formant body, all bands in one pass
+        float y = resonators.processSample(x);
 
         y = hp.processSample(y);
         y = lp.processSample(y);
@@ -230,9 +472,98 @@ void BreathLeadDSP::render (juce::AudioBuffer<float>& out, int startSample, int
         y *= outGain;
         y = std::clamp(y, -1.0f, 1.0f);
 
-        // write to all channels mono (or widen later)
-        ch0[startSample + i] += y;
-        for (int c = 1; c < chs; ++c)
-            out.getWritePointer(c)[startSample + i] += y;
+        monoScratch[i] = y;
+    }
+
+}
+
+void BreathLeadDSP::renderNoise (int numSamples)
+{
+    // colour usually sits at an extreme: only generate what the mix can hear
+    if (! smoothers.isMoving(smNoiseColor))
+    {
+        const float noiseColor = smoothers.getCurrent(smNoiseColor);
+
+        if (noiseColor <= 0.0f)
+        {
+            noise.fillWhite(noiseScratch, numSamples);
+            return;
+        }
+
+        if (noiseColor >= 1.0f)
+        {
+            noise.fillPink(noiseScratch, numSamples);
+            return;
+        }
+    }
+
+    noise.fillWhite(noiseScratch, numSamples);
+    noise.fillPink(pinkScratch, numSamples);
+
+    const float* noiseColor = smoothers.getRamp(smNoiseColor, numSamples);
+    for (int i = 0; i < numSamples; ++i)
+        noiseScratch[i] = (1.0f - noiseColor[i]) * noiseScratch[i] + noiseColor[i] * pinkScratch[i];
+}
+
+void BreathLeadDSP::renderMotion (int numSamples)
+{
+    // Aftertouch and bend only move at MIDI rate, and the synth splits blocks
+    // at MIDI events, so they are fed once at chunk start and then just decay.
+    // Wheel and breath come out of the smoother bank: while either ramps, the
+    // wheel tracker follows the ramp sample by sample, as the pitch tracker
+    // does while the pitch moves. A chunk where nothing moves is one feed and
+    // a closed-form decay.
+    if (! motionSustainEnabled)
+    {
+        std::fill(motionScratch, motionScratch + numSamples, 0.0f);
+        return;
     }
+
+    // feed derivatives of expressive controls; summed then softened
+    const float sens0 = smoothers.getValue(smMotionSens, 0);
+    float midiRate = meAT.process(aftertouch, sens0)
+                   + mePB.process(pitchBend, sens0);
+
+    const float decay = meMW.decay;
+    const float chunkDecay = std::pow(decay, (float) (numSamples - 1));
+
+    const bool wheelSteady = ! smoothers.isAnyMoving((1u << smModWheel) | (1u << smBreath));
+    const bool pitchSteady = std::all_of(hzScratch + 1, hzScratch + numSamples,
+                                         [hz0 = hzScratch[0]] (float hz) { return hz == hz0; });
+
+    if (wheelSteady && pitchSteady)
+    {
+        const float wheel = std::max(smoothers.getCurrent(smModWheel), smoothers.getCurrent(smBreath));
+        float total = meMW.process(wheel, sens0) + midiRate
+                    + 0.5f * mePitch.process(hzScratch[0] / 2000.0f, sens0); // scaled pitch motion cue
+
+        motionScratch[0] = std::min(1.0f, total);
+        for (int i = 1; i < numSamples; ++i)
+        {
+            total *= decay;
+            motionScratch[i] = std::min(1.0f, total);
+        }
+
+        meMW.advance(chunkDecay);
+        mePitch.advance(chunkDecay);
+    }
+    else
+    {
+        // a tracker fed an unchanged value just decays, so the steady one of
+        // the pair costs nothing extra here
+        const float* sens = smoothers.getRamp(smMotionSens, numSamples);
+        const float* wheel = smoothers.getRamp(smModWheel, numSamples);
+        const float* breath = smoothers.getRamp(smBreath, numSamples);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float eWheel = meMW.process(std::max(wheel[i], breath[i]), sens[i]);
+            const float ePitch = mePitch.process(hzScratch[i] / 2000.0f, sens[i]);
+            motionScratch[i] = std::min(1.0f, eWheel + midiRate + 0.5f * ePitch);
+            midiRate *= decay;
+        }
+    }
+
+    meAT.advance(chunkDecay);
+    mePB.advance(chunkDecay);
 }
@@ -0,0 +1,519 @@
+/*
+ * BreathLeadLanes.cpp
+ *
+ * Lane-packed BreathLead engine implementation
+ *
+ * Created: October 16, 2026
+ */
+
+#include "dsp/BreathLeadLanes.h"
+#include "BreathLeadParams.h"
+#include "dsp/FastMath.h"
+#include <algorithm>
+#include <cmath>
+
+namespace FastMath = SchillingerEcosystem::DSP::FastMath;
+
+static inline float dbToLin(float db) { return std::pow(10.0f, db / 20.0f); }
+
+static inline float coeffFromMs (float ms, double sr)
+{
+    const float tau = std::max(0.0001f, ms / 1000.0f);
+    return std::exp(-1.0f / (tau * (float) sr));
+}
+
+BreathLeadLanes::BreathLeadLanes()
+{
+    for (int l = 0; l < numLanes; ++l)
+    {
+        baseHz[l] = 220.0f;
+        setLanePan(l, 0.0f);
+    }
+}
+
+void BreathLeadLanes::prepare (double sampleRate, int samplesPerBlock)
+{
+    juce::ignoreUnused(samplesPerBlock);
+
+    sr = sampleRate;
+    invSr = 1.0f / (float) sr;
+
+    meMW.prepare(sr); meAT.prepare(sr); mePB.prepare(sr);
+    motionDecay = meMW.decay;
+
+    airS.reset(sr, 0.02); toneS.reset(sr, 0.02); formantS.reset(sr, 0.02); resistS.reset(sr, 0.02);
+    vibrDepthS.reset(sr, 0.05); vibrRateS.reset(sr, 0.05);
+    noiseColorS.reset(sr, 0.05); sineAnchorS.reset(sr, 0.05);
+    motionSensS.reset(sr, 0.05);
+    outGainS.reset(sr, 0.05);
+
+    // expression idles at full scale (CC11 = 127)
+    controllers[(int) BreathController::expression].setCurrentAndTarget(1.0f);
+
+    reset();
+}
+
+void BreathLeadLanes::reset()
+{
+    vibPhase = 0.0f;
+    meMW.reset(); meAT.reset(); mePB.reset();
+
+    for (int l = 0; l < numLanes; ++l)
+    {
+        gate[l] = 0.0f;
+        env[l] = 0.0f;
+        oscPhase[l] = 0.0f;
+
+        // decorrelated noise per lane
+        rng[l] = 0x12345678u + 0x9E3779B9u * (std::uint32_t) l;
+        pink0[l] = pink1[l] = pink2[l] = 0.0f;
+
+        mePitchLast[l] = mePitchEnergy[l] = 0.0f;
+
+        for (int b = 0; b < 3; ++b)
+            svfS1[b][l] = svfS2[b][l] = 0.0f;
+
+        hpS1[l] = hpS2[l] = lpS1[l] = lpS2[l] = 0.0f;
+    }
+
+    controlCountdown = 0;
+    coeffsValid = false;
+
+    asleep = true;
+    quietSamples = 0;
+}
+
+void BreathLeadLanes::noteOn (int lane, float hz, float vel01)
+{
+    jassert(lane >= 0 && lane < numLanes);
+    setLanePitchHz(lane, hz);
+    velocity[lane] = std::clamp(vel01, 0.0f, 1.0f);
+    gate[lane] = 1.0f;
+}
+
+void BreathLeadLanes::noteOff (int lane)
+{
+    jassert(lane >= 0 && lane < numLanes);
+    gate[lane] = 0.0f;
+}
+
+void BreathLeadLanes::setLanePitchHz (int lane, float hz)
+{
+    baseHz[lane] = std::clamp(hz, 20.0f, 12000.0f);
+}
+
+void BreathLeadLanes::setLanePan (int lane, float pan, float level)
+{
+    // centre = unity on both sides, so a centred lane at level 1 matches BreathLeadDSP
+    pan = std::clamp(pan, -1.0f, 1.0f);
+    gainL[lane] = level * std::min(1.0f, 1.0f - pan);
+    gainR[lane] = level * std::min(1.0f, 1.0f + pan);
+}
+
+bool BreathLeadLanes::isLaneActive (int lane) const
+{
+    return gate[lane] > 0.0f || (! asleep && env[lane] > 1.0e-4f);
+}
+
+bool BreathLeadLanes::anyGateOn() const
+{
+    for (int l = 0; l < numLanes; ++l)
+        if (gate[l] > 0.0f)
+            return true;
+
+    return false;
+}
+
+bool BreathLeadLanes::isAnyLaneActive() const
+{
+    for (int l = 0; l < numLanes; ++l)
+        if (isLaneActive(l))
+            return true;
+
+    return false;
+}
+
+void BreathLeadLanes::setModWheel (float mw01)        { setController(BreathController::modWheel, mw01); }
+void BreathLeadLanes::setAftertouch (float at01)      { aftertouch = std::clamp(at01, 0.0f, 1.0f); }
+void BreathLeadLanes::setPitchBendNorm (float pbNorm) { pitchBend = std::clamp(pbNorm, -1.0f, 1.0f); }
+
+void BreathLeadLanes::setController (BreathController controller, float value01, int rampSamples)
+{
+    controllers[(int) controller].setTarget(std::clamp(value01, 0.0f, 1.0f), rampSamples);
+}
+
+void BreathLeadLanes::setParams (float air, float tone, float formant, float resistance,
+                                 float vibrDepth, float vibrRateHz,
+                                 float noiseColor, float sineAnchor,
+                                 bool motionSustain, float motionSensitivity,
+                                 float attackMs, float releaseMs,
+                                 float outputGainDb)
+{
+    const float values[] = { air, tone, formant, resistance,
+                             vibrDepth, vibrRateHz,
+                             noiseColor, sineAnchor,
+                             motionSustain ? 1.0f : 0.0f, motionSensitivity,
+                             attackMs, releaseMs,
+                             outputGainDb };
+
+    for (int i = 0; i < (int) BreathLeadParam::numParams; ++i)
+        setParam((BreathLeadParam) i, values[i]);
+}
+
+void BreathLeadLanes::setParam (BreathLeadParam param, float value)
+{
+    switch (param)
+    {
+        case BreathLeadParam::air:               airS.setTargetValue(std::clamp(value, 0.0f, 1.0f)); break;
+        case BreathLeadParam::tone:              toneS.setTargetValue(std::clamp(value, 0.0f, 1.0f)); break;
+        case BreathLeadParam::formant:           formantS.setTargetValue(std::clamp(value, 0.0f, 1.0f)); break;
+        case BreathLeadParam::resistance:        resistS.setTargetValue(std::clamp(value, 0.0f, 1.0f)); break;
+
+        case BreathLeadParam::vibratoDepth:      vibrDepthS.setTargetValue(std::clamp(value, 0.0f, 1.0f)); break;
+        case BreathLeadParam::vibratoRateHz:     vibrRateS.setTargetValue(std::clamp(value, 0.5f, 8.0f)); break;
+
+        case BreathLeadParam::noiseColor:        noiseColorS.setTargetValue(std::clamp(value, 0.0f, 1.0f)); break;
+        case BreathLeadParam::sineAnchor:        sineAnchorS.setTargetValue(std::clamp(value, 0.0f, 1.0f)); break;
+
+        case BreathLeadParam::motionSustain:     motionSustainEnabled = value > 0.5f; break;
+        case BreathLeadParam::motionSensitivity: motionSensS.setTargetValue(std::clamp(value, 0.0f, 1.0f)); break;
+
+        case BreathLeadParam::attackMs:          envA = coeffFromMs(std::max(1.0f, value), sr); break;
+        case BreathLeadParam::releaseMs:         envR = coeffFromMs(std::max(5.0f, value), sr); break;
+
+        case BreathLeadParam::outputGainDb:      outGainS.setTargetValue(dbToLin(value)); break;
+
+        case BreathLeadParam::numParams:         break;
+    }
+}
+
+void BreathLeadLanes::setControlInterval (int numSamples)
+{
+    controlInterval = std::clamp(numSamples, 1, BreathLeadDSP::maxControlInterval);
+    controlCountdown = std::min(controlCountdown, controlInterval);
+}
+
+void BreathLeadLanes::updateControlRate (const float* hz, float tone, float form, float resistanceMix)
+{
+    const float pi = juce::MathConstants<float>::pi;
+
+    // resonance is channel-wide; cutoffs track each lane's pitch
+    const float r2Pitch = 1.0f / (0.7f + 0.25f * resistanceMix);
+    const float r2F1    = 1.0f / (0.55f + 0.25f * resistanceMix);
+    const float r2F2    = 1.0f / (0.45f + 0.20f * resistanceMix);
+
+    const float f1 = (1.0f - form) * 750.0f + form * 450.0f;
+    const float f2 = (1.0f - form) * 1200.0f + form * 2000.0f;
+
+    for (int l = 0; l < numLanes; ++l)
+    {
+        const float track = std::clamp(FastMath::log2(hz[l] / 220.0f) * 0.08f, -0.12f, 0.18f);
+        const float trackMul = FastMath::exp2(track);
+
+        const float fc[3] = { hz[l],
+                              std::clamp(f1 * trackMul, 120.0f, 6000.0f),
+                              std::clamp(f2 * trackMul, 200.0f, 8000.0f) };
+        const float r2[3] = { r2Pitch, r2F1, r2F2 };
+
+        for (int b = 0; b < 3; ++b)
+        {
+            const float g = std::tan(pi * fc[b] * invSr);
+            svfG[b][l] = g;
+            svfR2[b][l] = r2[b];
+            svfH[b][l] = 1.0f / (1.0f + r2[b] * g + g * g);
+        }
+    }
+
+    // --- Tone tilt (shared) ---
+    const auto hpT = RampedBiquad::makeHighPass(sr, 40.0f + (1.0f - tone) * 120.0f);
+    const auto lpT = RampedBiquad::makeLowPass(sr, 4500.0f + tone * 11500.0f);
+
+    auto ramp = [this] (RampedBiquad::Coeffs& cur, RampedBiquad::Coeffs& inc, const RampedBiquad::Coeffs& target)
+    {
+        if (! coeffsValid)
+        {
+            cur = target;
+            inc = RampedBiquad::Coeffs { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+            return;
+        }
+
+        const float k = 1.0f / (float) controlInterval;
+        inc.b0 = (target.b0 - cur.b0) * k;
+        inc.b1 = (target.b1 - cur.b1) * k;
+        inc.b2 = (target.b2 - cur.b2) * k;
+        inc.a1 = (target.a1 - cur.a1) * k;
+        inc.a2 = (target.a2 - cur.a2) * k;
+    };
+
+    ramp(hpC, hpInc, hpT);
+    ramp(lpC, lpInc, lpT);
+    coeffsValid = true;
+}
+
+void BreathLeadLanes::wake()
+{
+    asleep = false;
+    quietSamples = 0;
+
+    // parameter moves made while asleep take effect at once, not as a ramp
+    for (auto* s : { &airS, &toneS, &formantS, &resistS, &vibrDepthS, &vibrRateS,
+                     &noiseColorS, &sineAnchorS, &motionSensS, &outGainS })
+        s->setCurrentAndTargetValue(s->getTargetValue());
+
+    for (auto& c : controllers)
+        c.setCurrentAndTarget(c.getTargetValue());
+}
+
+void BreathLeadLanes::sleep()
+{
+    asleep = true;
+
+    for (int l = 0; l < numLanes; ++l)
+    {
+        env[l] = 0.0f;
+
+        for (int b = 0; b < 3; ++b)
+            svfS1[b][l] = svfS2[b][l] = 0.0f;
+
+        hpS1[l] = hpS2[l] = lpS1[l] = lpS2[l] = 0.0f;
+    }
+
+    controlCountdown = 0;
+    coeffsValid = false;
+}
+
+void BreathLeadLanes::updateIdleState (int numSamples, float peak)
+{
+    if (anyGateOn())
+    {
+        quietSamples = 0;
+        return;
+    }
+
+    quietSamples = (peak < BreathLeadDSP::silenceThreshold) ? quietSamples + numSamples : 0;
+
+    if (quietSamples >= (int) (BreathLeadDSP::silenceHoldMs * 0.001 * sr))
+        sleep();
+}
+
+void BreathLeadLanes::render (juce::AudioBuffer<float>& out, int startSample, int numSamples,
+                              const float* pressureBlock)
+{
+    // wake here rather than in noteOn so parameters pushed this block are snapped to
+    if (asleep)
+    {
+        if (! anyGateOn())
+            return;
+        wake();
+    }
+
+    const int chs = out.getNumChannels();
+    auto* left = out.getWritePointer(0, startSample);
+    auto* right = (chs > 1) ? out.getWritePointer(1, startSample) : nullptr;
+
+    const float noiseScale = 2.0f / 16777216.0f;
+
+    alignas(32) float hz[numLanes];
+    alignas(32) float outL[numLanes];
+    alignas(32) float outR[numLanes];
+    alignas(32) float pressure[numLanes];
+    alignas(32) float envCoeffHeld[numLanes];
+    alignas(32) float drive[numLanes];   // 0 = envelope follows the breath input directly
+
+    float motionShared = 0.0f;
+    float peak = 0.0f;
+    const bool breathMode = pressureBlock != nullptr;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        // smooth params (channel-wide)
+        const float air = airS.getNextValue();
+        const float tone = toneS.getNextValue();
+        const float form = formantS.getNextValue();
+        const float resistanceMix = resistS.getNextValue();
+        const float vibrDepth = vibrDepthS.getNextValue();
+        const float vibrRate = vibrRateS.getNextValue();
+        const float noiseColor = noiseColorS.getNextValue();
+        const float sineAnchor = sineAnchorS.getNextValue();
+        const float motionSens = motionSensS.getNextValue();
+        const float outGain = outGainS.getNextValue()
+                            * controllers[(int) BreathController::expression].getNextValue();
+        const float wheel = std::max(controllers[(int) BreathController::modWheel].getNextValue(),
+                                     controllers[(int) BreathController::breath].getNextValue());
+
+        // one vibrato LFO for the stack
+        const float vibr = FastMath::sin2Pi(vibPhase) * vibrDepth;
+        vibPhase += vibrRate * invSr;
+        if (vibPhase >= 1.0f) vibPhase -= 1.0f;
+
+        const float pitchMul = FastMath::semitonesToRatio(2.0f * pitchBend + vibr * 0.35f);
+
+        // channel-wide motion cues: the trackers are fed on the first sample of
+        // each render call (the synth splits at MIDI events, so bend and
+        // aftertouch are current) and decay after that; wheel and expression
+        // ramps still move per sample through pressure and outGain
+        if (motionSustainEnabled)
+            motionShared = (i == 0) ? meMW.process(wheel, motionSens)
+                                      + meAT.process(aftertouch, motionSens)
+                                      + mePB.process(pitchBend, motionSens)
+                                    : motionShared * motionDecay;
+
+        const float sensGain = 50.0f + 450.0f * motionSens;
+        const float breath = breathMode ? pressureBlock[i] : 0.0f;
+
+        for (int l = 0; l < numLanes; ++l)
+            hz[l] = std::clamp(baseHz[l] * pitchMul, 20.0f, 12000.0f);
+
+        if (--controlCountdown < 0)
+        {
+            updateControlRate(hz, tone, form, resistanceMix);
+            controlCountdown = controlInterval - 1;
+        }
+
+        hpC.b0 += hpInc.b0; hpC.b1 += hpInc.b1; hpC.b2 += hpInc.b2; hpC.a1 += hpInc.a1; hpC.a2 += hpInc.a2;
+        lpC.b0 += lpInc.b0; lpC.b1 += lpInc.b1; lpC.b2 += lpInc.b2; lpC.a1 += lpInc.a1; lpC.a2 += lpInc.a2;
+
+        const float noiseWhite = 1.0f - noiseColor;
+        const float noiseGain = 1.0f - 0.35f * resistanceMix;
+        const float sineGain = 0.15f * sineAnchor;
+        const float satGain = 1.2f + 0.9f * resistanceMix;
+
+        // The lane passes below hold no conditional arithmetic: GCC will not
+        // if-convert a float op it has sunk into a branch (-ftrapping-math),
+        // and one such branch keeps the whole lane loop scalar.
+        for (int l = 0; l < numLanes; ++l)
+        {
+            // --- Motion energy (pitch cue) ---
+            const float cue = hz[l] * (1.0f / 2000.0f);
+            const float d = std::abs(cue - mePitchLast[l]);
+            mePitchLast[l] = cue;
+            mePitchEnergy[l] = std::max(std::min(1.0f, d * sensGain), mePitchEnergy[l] * motionDecay);
+        }
+
+        // breath input replaces velocity + wheel and is tracked directly while held
+        if (breathMode)
+        {
+            for (int l = 0; l < numLanes; ++l)
+            {
+                pressure[l] = breath;
+                envCoeffHeld[l] = (gate[l] > 0.0f) ? 0.0f : 1.0f;
+            }
+        }
+        else
+        {
+            for (int l = 0; l < numLanes; ++l)
+            {
+                const float velSpeak = 0.20f + 0.80f * velocity[l];
+                pressure[l] = velSpeak * 0.55f + wheel * 0.75f;
+                envCoeffHeld[l] = 1.0f;
+            }
+        }
+
+        if (motionSustainEnabled)
+            for (int l = 0; l < numLanes; ++l)
+                pressure[l] += std::min(1.0f, motionShared + 0.5f * mePitchEnergy[l]) * 0.60f;
+
+        for (int l = 0; l < numLanes; ++l)
+        {
+            // --- Air envelope ---
+            const float target = gate[l] * std::clamp(pressure[l], 0.0f, 1.0f);
+            const float coeff = envCoeffHeld[l] * ((target > env[l]) ? envA : envR);
+            env[l] = target + coeff * (env[l] - target);
+        }
+
+        for (int l = 0; l < numLanes; ++l)
+        {
+            // --- Excitation: xorshift32 white + economy pink ---
+            std::uint32_t r = rng[l];
+            r ^= r << 13; r ^= r >> 17; r ^= r << 5;
+            const float w = (float) (std::int32_t) (r >> 8) * noiseScale - 1.0f;
+            r ^= r << 13; r ^= r >> 17; r ^= r << 5;
+            const float wp = (float) (std::int32_t) (r >> 8) * noiseScale - 1.0f;
+            rng[l] = r;
+
+            pink0[l] = 0.99765f * pink0[l] + wp * 0.0990460f;
+            pink1[l] = 0.96300f * pink1[l] + wp * 0.2965164f;
+            pink2[l] = 0.57000f * pink2[l] + wp * 1.0526913f;
+            const float p = (pink0[l] + pink1[l] + pink2[l] + wp * 0.1848f) * 0.25f;
+
+            const float n = noiseWhite * w + noiseColor * p;
+
+            // sine anchor
+            float ph = oscPhase[l] + hz[l] * invSr;
+            ph -= (float) (std::int32_t) ph;   // ph < 2: drops the whole cycle without a branch
+            oscPhase[l] = ph;
+            const float sine = FastMath::sin2Pi(ph);
+
+            const float x = (n * noiseGain + sine * sineGain) * (air * env[l]);
+
+            // --- Resonator bank (TPT SVF bandpass x3) ---
+            float bp[3];
+            for (int b = 0; b < 3; ++b)
+            {
+                const float g = svfG[b][l];
+                const float yHP = svfH[b][l] * (x - svfS1[b][l] * (g + svfR2[b][l]) - svfS2[b][l]);
+                const float yBP = yHP * g + svfS1[b][l];
+                svfS1[b][l] = yHP * g + yBP;
+                const float yLP = yBP * g + svfS2[b][l];
+                svfS2[b][l] = yBP * g + yLP;
+                bp[b] = yBP;
+            }
+
+            float y = 0.70f * bp[0] + 0.40f * bp[1] + 0.30f * bp[2];
+
+            // --- Tone tilt (TDF-II, shared coefficients) ---
+            const float yh = hpC.b0 * y + hpS1[l];
+            hpS1[l] = hpC.b1 * y - hpC.a1 * yh + hpS2[l];
+            hpS2[l] = hpC.b2 * y - hpC.a2 * yh;
+
+            const float yl = lpC.b0 * yh + lpS1[l];
+            lpS1[l] = lpC.b1 * yh - lpC.a1 * yl + lpS2[l];
+            lpS2[l] = lpC.b2 * yh - lpC.a2 * yl;
+
+            drive[l] = yl * satGain;
+        }
+
+        // --- Saturation + output (clamps in passes of their own) ---
+        for (int l = 0; l < numLanes; ++l)
+            drive[l] = std::min(std::max(drive[l], -3.0f), 3.0f);
+
+        for (int l = 0; l < numLanes; ++l)
+            outL[l] = SoftLimiter::shape(drive[l]) * outGain;
+
+        for (int l = 0; l < numLanes; ++l)
+        {
+            const float y = std::min(std::max(outL[l], -1.0f), 1.0f);
+            outL[l] = y * gainL[l];
+            outR[l] = y * gainR[l];
+        }
+
+        float sumL = 0.0f, sumR = 0.0f;
+        for (int l = 0; l < numLanes; ++l)
+        {
+            sumL += outL[l];
+            sumR += outR[l];
+        }
+
+        peak = std::max(peak, std::max(std::abs(sumL), std::abs(sumR)));
+
+        if (right != nullptr)
+        {
+            left[i] += sumL;
+            right[i] += sumR;
+        }
+        else
+        {
+            left[i] += 0.5f * (sumL + sumR);
+        }
+    }
+
+    if (motionSustainEnabled && numSamples > 1)
+    {
+        const float blockDecay = std::pow(motionDecay, (float) (numSamples - 1));
+        meMW.advance(blockDecay);
+        meAT.advance(blockDecay);
+        mePB.advance(blockDecay);
+    }
+
+    updateIdleState(numSamples, peak);
+}
@@ -15,12 +15,39 @@ struct BreathLeadSound : public juce::SynthesiserSound
     bool appliesToChannel (int) override { return true; }
 };
 
-BreathLeadSynth::BreathLeadSynth (juce::AudioProcessorValueTreeState& apvtsRef)
-: apvts(apvtsRef)
+BreathLeadSynth::BreathLeadSynth (juce::AudioProcessorValueTreeState& apvtsRef, VoiceMode mode)
+: params(apvtsRef), voiceMode(mode)
 {
-    // Mono with optional unison (set to 1 voice for now)
-    for (int i = 0; i < 1; ++i)
-        addVoice (new BreathLeadVoice (apvts));
+    constexpr int numLanes = BreathLeadLanes::numLanes;
+
+    switch (voiceMode)
+    {
+        case VoiceMode::mono:
+            addVoice (new BreathLeadVoice (params));
+            break;
+
+        case VoiceMode::unison:
+        {
+            // one voice owns every lane; detune +-12 cents and spread across the field.
+            // The lanes start nearly in phase, so each is scaled by 1/sqrt(numLanes)
+            // to keep the stack close to the mono voice's level.
+            auto* voice = new BreathLeadLaneVoice (lanes, (1u << numLanes) - 1u);
+            const float laneLevel = 1.0f / std::sqrt ((float) numLanes);
+            for (int l = 0; l < numLanes; ++l)
+            {
+                const float pos = (2.0f * (float) l / (float) (numLanes - 1)) - 1.0f; // -1..1
+                voice->setLaneDetuneCents (l, 12.0f * pos);
+                lanes.setLanePan (l, 0.8f * pos, laneLevel);
+            }
+            addVoice (voice);
+            break;
+        }
+
+        case VoiceMode::poly:
+            for (int l = 0; l < numLanes; ++l)
+                addVoice (new BreathLeadLaneVoice (lanes, 1u << l));
+            break;
+    }
 
     addSound (new BreathLeadSound());
 }
@@ -30,8 +57,16 @@ void BreathLeadSynth::prepare (double sampleRate, int samplesPerBlock, int numCh
     setCurrentPlaybackSampleRate (sampleRate);
 
     // Voice preparation happens in setCurrentPlaybackSampleRate
-    juce::ignoreUnused(samplesPerBlock);
     juce::ignoreUnused(numChannels);
+
+    controllerInput.prepare (sampleRate);
+    sampleClock = 0;
+
+    if (voiceMode != VoiceMode::mono)
+    {
+        lanes.prepare (sampleRate, samplesPerBlock);
+        laneParamReader.invalidate();
+    }
 }
 
 void BreathLeadSynth::reset()
@@ -39,4 +74,69 @@ void BreathLeadSynth::reset()
     // Clear all voices
     for (auto* voice : voices)
         voice->stopNote(0.0f, false);
+
+    if (voiceMode != VoiceMode::mono)
+        lanes.reset();
+}
+
+void BreathLeadSynth::setBreathPressure (const float* pressure, int firstSample)
+{
+    breathPressure = pressure;
+    breathPressureStart = firstSample;
+
+    if (voiceMode == VoiceMode::mono)
+        for (auto* voice : voices)
+            static_cast<BreathLeadVoice*> (voice)->setBreathPressure (pressure, firstSample);
+}
+
+void BreathLeadSynth::handleController (int midiChannel, int controllerNumber, int controllerValue)
+{
+    BreathControllerInput::Update update;
+
+    if (controllerInput.handleControlChange (controllerNumber, controllerValue, sampleClock, update))
+        applyController (update);
+    else
+        juce::Synthesiser::handleController (midiChannel, controllerNumber, controllerValue);
+}
+
+void BreathLeadSynth::handleHighResController (int controllerNumber, std::uint32_t value)
+{
+    BreathController controller;
+
+    if (BreathControllerInput::fromControllerNumber (controllerNumber, controller))
+        applyController (controllerInput.handleHighRes (controller, value, sampleClock));
+}
+
+void BreathLeadSynth::applyController (const BreathControllerInput::Update& update)
+{
+    // channel-wide expression: idle voices keep it for their next note
+    if (voiceMode == VoiceMode::mono)
+    {
+        for (auto* voice : voices)
+            static_cast<BreathLeadVoice*> (voice)->setController (update.controller, update.value, update.rampSamples);
+    }
+    else
+    {
+        lanes.setController (update.controller, update.value, update.rampSamples);
+    }
+}
+
+void BreathLeadSynth::updateLaneParamsFromAPVTS()
+{
+    params.pushChanges (laneParamReader, lanes);
+}
+
+void BreathLeadSynth::renderVoices (juce::AudioBuffer<float>& outputAudio, int startSample, int numSamples)
+{
+    // mono: BreathLeadVoice renders itself; lane voices only do bookkeeping here
+    juce::Synthesiser::renderVoices (outputAudio, startSample, numSamples);
+
+    if (voiceMode != VoiceMode::mono)
+    {
+        updateLaneParamsFromAPVTS();
+        lanes.render (outputAudio, startSample, numSamples,
+                      breathPressure != nullptr ? breathPressure + (startSample - breathPressureStart) : nullptr);
+    }
+
+    sampleClock += numSamples;
 }
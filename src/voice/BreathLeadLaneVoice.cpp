@@ -0,0 +1,81 @@
+/*
+ * BreathLeadLaneVoice.cpp
+ *
+ * Lane proxy voice implementation
+ *
+ * Created: October 16, 2026
+ */
+
+#include "voice/BreathLeadLaneVoice.h"
+#include <cmath>
+#include <algorithm>
+
+static inline float midiToHz (int midiNote)
+{
+    return 440.0f * std::pow(2.0f, (midiNote - 69) / 12.0f);
+}
+
+BreathLeadLaneVoice::BreathLeadLaneVoice (BreathLeadLanes& lanesRef, unsigned laneMask)
+: lanes(lanesRef), mask(laneMask)
+{
+    std::fill(std::begin(detuneRatio), std::end(detuneRatio), 1.0f);
+}
+
+void BreathLeadLaneVoice::setLaneDetuneCents (int lane, float cents)
+{
+    detuneRatio[lane] = std::pow(2.0f, cents / 1200.0f);
+}
+
+bool BreathLeadLaneVoice::canPlaySound (juce::SynthesiserSound* s)
+{
+    return (dynamic_cast<juce::SynthesiserSound*>(s) != nullptr);
+}
+
+void BreathLeadLaneVoice::startNote (int midiNoteNumber, float vel, juce::SynthesiserSound*, int)
+{
+    const float hz = midiToHz(midiNoteNumber);
+
+    for (int l = 0; l < BreathLeadLanes::numLanes; ++l)
+        if (mask & (1u << l))
+            lanes.noteOn(l, hz * detuneRatio[l], vel);
+}
+
+void BreathLeadLaneVoice::stopNote (float, bool allowTailOff)
+{
+    for (int l = 0; l < BreathLeadLanes::numLanes; ++l)
+        if (mask & (1u << l))
+            lanes.noteOff(l);
+
+    if (!allowTailOff)
+        clearCurrentNote();
+}
+
+void BreathLeadLaneVoice::pitchWheelMoved (int newPitchWheelValue)
+{
+    lanes.setPitchBendNorm((newPitchWheelValue - 8192) / 8192.0f);
+}
+
+void BreathLeadLaneVoice::controllerMoved (int, int)
+{
+    // CC1/2/11 are decoded by BreathLeadSynth::handleController and applied
+    // to the shared lanes there; nothing else is mapped
+}
+
+void BreathLeadLaneVoice::aftertouchChanged (int newAftertouchValue)
+{
+    lanes.setAftertouch(newAftertouchValue / 127.0f);
+}
+
+void BreathLeadLaneVoice::renderNextBlock (juce::AudioBuffer<float>&, int, int)
+{
+    // audio comes from BreathLeadSynth::renderVoices; just free the voice
+    // once all of its lanes have released
+    if (! isVoiceActive())
+        return;
+
+    for (int l = 0; l < BreathLeadLanes::numLanes; ++l)
+        if ((mask & (1u << l)) && lanes.isLaneActive(l))
+            return;
+
+    clearCurrentNote();
+}
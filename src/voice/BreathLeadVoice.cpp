@@ -21,8 +21,8 @@ float BreathLeadVoice::coeffFromMs (float ms) const
     return std::exp(-1.0f / (tau * (float) sr));
 }
 
-BreathLeadVoice::BreathLeadVoice (juce::AudioProcessorValueTreeState& apvtsRef)
-: apvts(apvtsRef)
+BreathLeadVoice::BreathLeadVoice (BreathLeadParamSnapshot& paramsRef)
+: params(paramsRef)
 {
 }
 
@@ -37,6 +37,9 @@ void BreathLeadVoice::setCurrentPlaybackSampleRate (double newRate)
     // prepare with modest block assumption; synth will re-prepare if needed
     dsp.prepare(sr, 512, 2);
     glideCoeff = coeffFromMs(std::max(1.0f, portamentoMs));
+
+    // rate-dependent coefficients must be re-derived from every parameter
+    paramReader.invalidate();
 }
 
 void BreathLeadVoice::startNote (int midiNoteNumber, float vel, juce::SynthesiserSound*, int)
@@ -45,6 +48,8 @@ void BreathLeadVoice::startNote (int midiNoteNumber, float vel, juce::Synthesise
     if (! isVoiceActive())
         currentHz = targetHz;
 
+    // a sleeping dsp missed parameter updates; apply them before it wakes
+    updateParamsFromAPVTS();
     dsp.setGate(true);
     dsp.setVelocity(std::clamp(vel, 0.0f, 1.0f));
 }
@@ -64,13 +69,10 @@ void BreathLeadVoice::pitchWheelMoved (int newPitchWheelValue)
     dsp.setPitchBendNorm(pitchBendNorm);
 }
 
-void BreathLeadVoice::controllerMoved (int controllerNumber, int newControllerValue)
+void BreathLeadVoice::controllerMoved (int, int)
 {
-    if (controllerNumber == 1) // modwheel
-    {
-        modWheel01 = std::clamp(newControllerValue / 127.0f, 0.0f, 1.0f);
-        dsp.setModWheel(modWheel01);
-    }
+    // CC1/2/11 never reach the voice: BreathLeadSynth::handleController
+    // decodes them and calls setController; nothing else is mapped
 }
 
 void BreathLeadVoice::aftertouchChanged (int newAftertouchValue)
@@ -81,40 +83,37 @@ void BreathLeadVoice::aftertouchChanged (int newAftertouchValue)
 
 void BreathLeadVoice::updateParamsFromAPVTS()
 {
-    auto getF = [&](const char* id){ return apvts.getRawParameterValue(id)->load(); };
-    auto getB = [&](const char* id){ return apvts.getRawParameterValue(id)->load() > 0.5f; };
-
-    dsp.setParams(
-        getF(BreathLeadParamIDs::air),
-        getF(BreathLeadParamIDs::tone),
-        getF(BreathLeadParamIDs::formant),
-        getF(BreathLeadParamIDs::resistance),
-        getF(BreathLeadParamIDs::vibratoDepth),
-        getF(BreathLeadParamIDs::vibratoRateHz),
-        getF(BreathLeadParamIDs::noiseColor),
-        getF(BreathLeadParamIDs::sineAnchor),
-        getB(BreathLeadParamIDs::motionSustain),
-        getF(BreathLeadParamIDs::motionSensitivity),
-        getF(BreathLeadParamIDs::attackMs),
-        getF(BreathLeadParamIDs::releaseMs),
-        getF(BreathLeadParamIDs::outputGainDb)
-    );
+    // idle blocks cost one generation compare
+    params.pushChanges(paramReader, dsp);
 }
 
 void BreathLeadVoice::renderNextBlock (juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples)
 {
-    updateParamsFromAPVTS();
+    // decayed voices cost nothing until the next note
+    if (! dsp.isActive())
+        return;
 
-    // glide toward target
-    glideCoeff = coeffFromMs(std::max(1.0f, portamentoMs));
+    updateParamsFromAPVTS();
 
-    for (int i = 0; i < numSamples; ++i)
+    while (numSamples > 0)
     {
-        currentHz = targetHz + glideCoeff * (currentHz - targetHz);
-        dsp.setPitchHz(currentHz);
+        const int n = std::min(numSamples, BreathLeadDSP::maxChunkSize);
+
+        // exponential glide curve for this chunk
+        for (int i = 0; i < n; ++i)
+        {
+            currentHz = targetHz + glideCoeff * (currentHz - targetHz);
+            glideHz[i] = currentHz;
+        }
+
+        dsp.renderBlock(outputBuffer, startSample, n, glideHz,
+                        breathPressure != nullptr ? breathPressure + (startSample - breathPressureStart) : nullptr);
 
-        // render one sample at a time (simple + stable; optimize to blocks later)
-        juce::AudioBuffer<float> temp (outputBuffer.getArrayOfWritePointers(), outputBuffer.getNumChannels(), startSample + i, 1);
-        dsp.render(temp, 0, 1);
+        startSample += n;
+        numSamples -= n;
     }
+
+    // tail has died away: hand the voice back to the synth
+    if (! dsp.isActive())
+        clearCurrentNote();
 }
@@ -0,0 +1,197 @@
+/*
+  ==============================================================================
+
+    BreathLeadThreadingTests.cpp
+    Created: October 16, 2026
+
+    Multi-instance stress harness
+    - N engines rendered on N threads match the same engines rendered serially
+      bit for bit (no state shared between instances)
+    - Throughput of serial vs parallel rendering as N grows
+
+  ==============================================================================
+*/
+
+#include <juce_core/juce_core.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include "dsp/BreathLeadDSP.h"
+#include "dsp/BreathLeadLanes.h"
+#include "BreathLeadParams.h"
+
+//==============================================================================
+// HELPERS
+//==============================================================================
+
+namespace
+{
+    constexpr double kSampleRate = 48000.0;
+    constexpr int kBlockSize = 256;
+    constexpr double kSeconds = 4.0;
+
+    /** One plugin instance: its own parameter snapshot feeding its own engine. */
+    struct Instance
+    {
+        BreathLeadParamSnapshot params;
+        BreathLeadParamSnapshot::Reader dspReader, lanesReader;
+        BreathLeadDSP dsp;
+        BreathLeadLanes lanes;
+        std::vector<float> output;
+    };
+
+    /** Plays a scripted phrase (note, controller gestures, parameter moves,
+        release) on instance index; every index gets a different pitch and timbre. */
+    void renderPerformance (Instance& inst, int index)
+    {
+        const int numBlocks = (int) (kSeconds * kSampleRate) / kBlockSize;
+        juce::AudioBuffer<float> buffer (2, kBlockSize);
+        inst.output.assign((size_t) (numBlocks * kBlockSize * 2), 0.0f);
+
+        const float defaults[] = { 0.45f, 0.5f, 0.5f, 0.3f, 0.1f, 5.0f, 0.7f, 0.3f,
+                                   1.0f, 0.6f, 50.0f, 300.0f, -3.0f };
+        for (int p = 0; p < BreathLeadParamSnapshot::numParams; ++p)
+            inst.params.setValue((BreathLeadParam) p, defaults[p]);
+        inst.params.setValue(BreathLeadParam::formant, 0.1f * (float) (index % 10));
+
+        inst.dsp.prepare(kSampleRate, kBlockSize, 1);
+        inst.lanes.prepare(kSampleRate, kBlockSize);
+
+        const float hz = 110.0f * std::pow(2.0f, (float) (index % 24) / 12.0f);
+        inst.dsp.setPitchHz(hz);
+        inst.dsp.setVelocity(0.8f);
+        inst.dsp.setGate(true);
+        for (int l = 0; l < BreathLeadLanes::numLanes; ++l)
+            inst.lanes.noteOn(l, hz * std::pow(2.0f, (float) (l - 4) * 0.002f), 0.7f);
+
+        for (int b = 0; b < numBlocks; ++b)
+        {
+            const double t = (double) (b * kBlockSize) / kSampleRate;
+
+            const float wheel = (t > 1.0 && t < 2.0) ? (float) (t - 1.0) : 0.0f;
+            inst.dsp.setModWheel(wheel);
+            inst.lanes.setModWheel(wheel);
+
+            if (b == (int) (2.0 * kSampleRate) / kBlockSize)
+                inst.params.setValue(BreathLeadParam::tone, 0.9f);
+
+            if (b == (int) (3.0 * kSampleRate) / kBlockSize)
+            {
+                inst.dsp.setGate(false);
+                for (int l = 0; l < BreathLeadLanes::numLanes; ++l)
+                    inst.lanes.noteOff(l);
+            }
+
+            inst.params.pushChanges(inst.dspReader, inst.dsp);
+            inst.params.pushChanges(inst.lanesReader, inst.lanes);
+
+            buffer.clear();
+            inst.dsp.render(buffer, 0, kBlockSize);
+            inst.lanes.render(buffer, 0, kBlockSize);
+
+            auto* dst = inst.output.data() + (size_t) (b * kBlockSize * 2);
+            std::copy(buffer.getReadPointer(0), buffer.getReadPointer(0) + kBlockSize, dst);
+            std::copy(buffer.getReadPointer(1), buffer.getReadPointer(1) + kBlockSize, dst + kBlockSize);
+        }
+    }
+
+    /** Renders every instance, serially or one thread each; returns wall-clock seconds. */
+    double renderAll (std::vector<Instance>& instances, bool parallel)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        if (parallel)
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(instances.size());
+            for (size_t i = 0; i < instances.size(); ++i)
+                threads.emplace_back([&instances, i] { renderPerformance(instances[i], (int) i); });
+            for (auto& t : threads)
+                t.join();
+        }
+        else
+        {
+            for (size_t i = 0; i < instances.size(); ++i)
+                renderPerformance(instances[i], (int) i);
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double>(end - start).count();
+    }
+}
+
+//==============================================================================
+// BREATHLEAD THREADING TEST SUITE
+//==============================================================================
+
+class BreathLeadThreadingTests : public juce::UnitTest
+{
+public:
+    BreathLeadThreadingTests() : juce::UnitTest("BreathLead Threading", "DSP") {}
+
+    void runTest() override
+    {
+        const int numCores = (int) std::max(2u, std::thread::hardware_concurrency());
+
+        beginTest("Parallel Instances Match Serial Rendering");
+        {
+            const int numInstances = std::min(numCores, 16);
+            std::vector<Instance> serial ((size_t) numInstances), parallel ((size_t) numInstances);
+
+            renderAll(serial, false);
+            renderAll(parallel, true);
+
+            int mismatched = 0;
+            bool audible = true;
+            for (int i = 0; i < numInstances; ++i)
+            {
+                mismatched += (serial[(size_t) i].output != parallel[(size_t) i].output) ? 1 : 0;
+
+                float peak = 0.0f;
+                for (auto v : serial[(size_t) i].output)
+                    peak = std::max(peak, std::abs(v));
+                audible = audible && peak > 1.0e-3f;
+            }
+
+            logMessage(juce::String::formatted("  %d instances on %d threads, %d differ from serial",
+                numInstances, numInstances, mismatched));
+            expectEquals(mismatched, 0);
+            expect(audible, "An instance rendered silence");
+        }
+
+        beginTest("Serial vs Parallel Throughput");
+        {
+            double serialRate = 0.0;
+
+            for (int n = 1; n <= std::min(numCores, 16); n *= 2)
+            {
+                std::vector<Instance> serial ((size_t) n), parallel ((size_t) n);
+                const double tSerial = renderAll(serial, false);
+                const double tParallel = renderAll(parallel, true);
+
+                // realtime multiple: seconds of audio (all instances) per wall-clock second
+                const double rtSerial = kSeconds * n / tSerial;
+                const double rtParallel = kSeconds * n / tParallel;
+                if (n == 1)
+                    serialRate = rtSerial;
+
+                logMessage(juce::String::formatted("  %2d instances: serial %7.1fx realtime, parallel %7.1fx (%.2fx speedup)",
+                    n, rtSerial, rtParallel, tSerial / tParallel));
+
+                if (n >= 4)
+                    expect(rtParallel > serialRate * 1.5,
+                        juce::String::formatted("%d threads do not scale past one", n));
+            }
+        }
+    }
+};
+
+//==============================================================================
+// Static test registration
+//==============================================================================
+
+static BreathLeadThreadingTests breathLeadThreadingTests;
@@ -0,0 +1,238 @@
+/*
+  ==============================================================================
+
+    FastMathTests.cpp
+    Created: October 16, 2026
+
+    FastMath accuracy and speed
+    - Max error of every kernel against libm (double) over its domain
+    - Block kernels match their scalar forms
+    - Block kernel throughput vs std:: loops
+
+  ==============================================================================
+*/
+
+#include <juce_core/juce_core.h>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include "dsp/FastMath.h"
+
+namespace FM = SchillingerEcosystem::DSP::FastMath;
+
+//==============================================================================
+// HELPERS
+//==============================================================================
+
+namespace
+{
+    enum class ErrorKind
+    {
+        absolute,
+        relative,
+        scaled      // absolute below magnitude 1, relative above
+    };
+
+    /** Max error of fast vs reference over num points in [lo, hi]. */
+    double maxError (const std::function<float (float)>& fast,
+                     const std::function<double (double)>& reference,
+                     double lo, double hi, ErrorKind kind, int num = 1000000)
+    {
+        double worst = 0.0;
+
+        for (int i = 0; i <= num; ++i)
+        {
+            const float x = (float) (lo + (hi - lo) * (double) i / (double) num);
+            const double ref = reference((double) x);
+            double err = std::abs((double) fast(x) - ref);
+            if (kind == ErrorKind::relative)
+                err /= std::abs(ref);
+            else if (kind == ErrorKind::scaled)
+                err /= std::max(1.0, std::abs(ref));
+            worst = std::max(worst, err);
+        }
+
+        return worst;
+    }
+
+    /** Nanoseconds per element of fn applied to a 512-sample buffer. */
+    double measureNsPerElement (const std::function<void (float*, const float*, int)>& fn,
+                                const std::vector<float>& in, float& sink)
+    {
+        std::vector<float> out (in.size());
+        constexpr int numRuns = 4000;
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for (int run = 0; run < numRuns; ++run)
+        {
+            fn(out.data(), in.data(), (int) in.size());
+            sink += out[(size_t) run % out.size()];
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double, std::nano> elapsed = end - start;
+        return elapsed.count() / (double) (numRuns * (int) in.size());
+    }
+}
+
+//==============================================================================
+// FASTMATH TEST SUITE
+//==============================================================================
+
+class FastMathTests : public juce::UnitTest
+{
+public:
+    FastMathTests() : juce::UnitTest("FastMath", "DSP") {}
+
+    void runTest() override
+    {
+        const double twoPi = 6.283185307179586;
+
+        //======================================================================
+        // ACCURACY (bounds match the table in FastMath.h)
+        //======================================================================
+
+        beginTest("sin2Pi / cos2Pi Error");
+        {
+            const double sinErr = maxError(FM::sin2Pi, [&] (double x) { return std::sin(twoPi * x); },
+                                           -65536.0, 65536.0, ErrorKind::absolute);
+            const double cosErr = maxError(FM::cos2Pi, [&] (double x) { return std::cos(twoPi * x); },
+                                           -65536.0, 65536.0, ErrorKind::absolute);
+            logMessage(juce::String::formatted("  sin2Pi max abs error %.3g, cos2Pi %.3g", sinErr, cosErr));
+            expect(sinErr < 2.5e-7 && cosErr < 2.5e-7, "sin2Pi/cos2Pi outside error budget");
+        }
+
+        beginTest("sin / cos Error");
+        {
+            const double sinErr = maxError(FM::sin, [] (double x) { return std::sin(x); }, -4096.0, 4096.0, ErrorKind::absolute);
+            const double cosErr = maxError(FM::cos, [] (double x) { return std::cos(x); }, -4096.0, 4096.0, ErrorKind::absolute);
+            logMessage(juce::String::formatted("  sin max abs error %.3g, cos %.3g", sinErr, cosErr));
+            expect(sinErr < 4.0e-7 && cosErr < 4.0e-7, "sin/cos outside error budget");
+        }
+
+        beginTest("exp2 / exp Error");
+        {
+            const double exp2Err = maxError(FM::exp2, [] (double x) { return std::exp2(x); }, -126.0, 127.0, ErrorKind::relative);
+            const double expErr = maxError(FM::exp, [] (double x) { return std::exp(x); }, -87.0, 88.0, ErrorKind::relative);
+            logMessage(juce::String::formatted("  exp2 max rel error %.3g, exp %.3g", exp2Err, expErr));
+            expect(exp2Err < 2.5e-7, "exp2 outside error budget");
+            expect(expErr < 2.5e-7, "exp outside error budget");
+
+            expectEquals(FM::exp2(0.0f), 1.0f);
+            expectEquals(FM::exp2(10.0f), 1024.0f);
+            expect(std::isfinite(FM::exp2(1000.0f)) && FM::exp2(-1000.0f) > 0.0f, "exp2 does not clamp");
+        }
+
+        beginTest("log2 Error");
+        {
+            const double errSmall = maxError(FM::log2, [] (double x) { return std::log2(x); }, 1.0e-30, 1.0e-20, ErrorKind::scaled);
+            const double errUnit = maxError(FM::log2, [] (double x) { return std::log2(x); }, 0.01, 100.0, ErrorKind::scaled);
+            const double errLarge = maxError(FM::log2, [] (double x) { return std::log2(x); }, 1.0e20, 1.0e30, ErrorKind::scaled);
+            logMessage(juce::String::formatted("  log2 max scaled error %.3g / %.3g / %.3g", errSmall, errUnit, errLarge));
+            expect(std::max({errSmall, errUnit, errLarge}) < 4.0e-7, "log2 outside error budget");
+
+            expectEquals(FM::log2(1.0f), 0.0f);
+            expectEquals(FM::log2(8.0f), 3.0f);
+        }
+
+        beginTest("semitonesToRatio Error");
+        {
+            const double err = maxError(FM::semitonesToRatio, [] (double s) { return std::pow(2.0, s / 12.0); },
+                                        -1512.0, 1524.0, ErrorKind::relative);
+            const double cents = 1200.0 * std::log2(1.0 + err);
+            logMessage(juce::String::formatted("  semitonesToRatio max rel error %.3g (%.2g cents)", err, cents));
+            expect(err < 2.5e-7, "semitonesToRatio outside error budget");
+        }
+
+        //======================================================================
+        // BLOCK KERNELS
+        //======================================================================
+
+        beginTest("Block Kernels Match Scalar Kernels");
+        {
+            std::vector<float> in (1027), out (in.size());
+            for (size_t i = 0; i < in.size(); ++i)
+                in[i] = 0.01f + 0.37f * (float) i;
+
+            // not bit-exact: the vectorised loop may contract to FMA differently
+            double worst = 0.0;
+            auto check = [&] (float (*scalar) (float))
+            {
+                for (size_t i = 0; i < in.size(); ++i)
+                {
+                    const double ref = scalar(in[i]);
+                    worst = std::max(worst, std::abs(out[i] - ref) / std::max(1.0, std::abs(ref)));
+                }
+            };
+
+            FM::sin2PiBlock(out.data(), in.data(), (int) in.size());           check(FM::sin2Pi);
+            FM::cos2PiBlock(out.data(), in.data(), (int) in.size());           check(FM::cos2Pi);
+            FM::exp2Block(out.data(), in.data(), (int) in.size());             check(FM::exp2);
+            FM::expBlock(out.data(), in.data(), (int) in.size());              check(FM::exp);
+            FM::log2Block(out.data(), in.data(), (int) in.size());             check(FM::log2);
+            FM::semitonesToRatioBlock(out.data(), in.data(), (int) in.size()); check(FM::semitonesToRatio);
+
+            expect(worst < 1.0e-6, juce::String::formatted("Block kernel differs from scalar by %g", worst));
+        }
+
+        //======================================================================
+        // THROUGHPUT
+        //======================================================================
+
+        beginTest("Block Kernel Throughput vs libm");
+        {
+            std::vector<float> in (512);
+            for (size_t i = 0; i < in.size(); ++i)
+                in[i] = -2.0f + 4.0f * (float) i / (float) in.size() + 0.001f;
+
+            std::vector<float> positive (in.size());
+            for (size_t i = 0; i < in.size(); ++i)
+                positive[i] = 0.5f + std::abs(in[i]) * 100.0f;
+
+            float sink = 0.0f;
+
+            struct Case
+            {
+                const char* name;
+                std::function<void (float*, const float*, int)> fast, reference;
+                const std::vector<float>* input;
+            };
+
+            const Case cases[] =
+            {
+                { "sin2Pi", FM::sin2PiBlock,
+                  [] (float* o, const float* x, int n) { for (int i = 0; i < n; ++i) o[i] = std::sin(6.2831853f * x[i]); }, &in },
+                { "exp2", FM::exp2Block,
+                  [] (float* o, const float* x, int n) { for (int i = 0; i < n; ++i) o[i] = std::exp2(x[i]); }, &in },
+                { "exp", FM::expBlock,
+                  [] (float* o, const float* x, int n) { for (int i = 0; i < n; ++i) o[i] = std::exp(x[i]); }, &in },
+                { "log2", FM::log2Block,
+                  [] (float* o, const float* x, int n) { for (int i = 0; i < n; ++i) o[i] = std::log2(x[i]); }, &positive },
+                { "semitones", FM::semitonesToRatioBlock,
+                  [] (float* o, const float* x, int n) { for (int i = 0; i < n; ++i) o[i] = std::pow(2.0f, x[i] / 12.0f); }, &in },
+            };
+
+            for (const auto& c : cases)
+            {
+                const double nsFast = measureNsPerElement(c.fast, *c.input, sink);
+                const double nsRef = measureNsPerElement(c.reference, *c.input, sink);
+
+                logMessage(juce::String::formatted("  %-10s fast %6.2f ns, libm %6.2f ns (%.1fx)",
+                    c.name, nsFast, nsRef, nsRef / nsFast));
+
+                expect(nsFast < nsRef, juce::String::formatted("%s block kernel slower than libm", c.name));
+            }
+
+            expect(std::isfinite(sink));
+        }
+    }
+};
+
+//==============================================================================
+// Static test registration
+//==============================================================================
+
+static FastMathTests fastMathTests;
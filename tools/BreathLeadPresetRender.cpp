@@ -0,0 +1,308 @@
+/*
+ * BreathLeadPresetRender.cpp
+ *
+ * Headless bulk renderer for BreathLead presets (QA and preview audio)
+ * - Loads every preset XML under a directory into its own BreathLeadPlugin
+ * - Plays a test phrase (built in, or a standard MIDI file) and writes
+ *   24-bit stereo WAV, mirroring the preset folder layout
+ * - Presets are spread over a thread pool; each one reports its render
+ *   speed as a realtime multiple
+ *
+ * Usage:
+ *   BreathLeadPresetRender <presetDir> <outputDir>
+ *                          [--threads N] [--rate Hz] [--block N] [--midi file.mid]
+ *
+ * Exit code is 1 if any preset fails to load or renders non-finite audio.
+ *
+ * Created: October 16, 2026
+ */
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include "BreathLeadPlugin.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    struct RenderSettings
+    {
+        double sampleRate = 48000.0;
+        int blockSize = 512;
+        double tailSeconds = 2.0; // rendered after the last MIDI event
+    };
+
+    struct RenderResult
+    {
+        juce::String name;
+        juce::String error;       // empty on success
+        double audioSeconds = 0.0;
+        double renderSeconds = 0.0;
+        float peak = 0.0f;
+    };
+
+    // Exercises the expressive paths: mod-wheel swell, legato glide,
+    // pitch-bend and aftertouch gestures, staccato notes, release tails
+    juce::MidiMessageSequence makeTestPhrase()
+    {
+        juce::MidiMessageSequence seq;
+        auto add = [&seq] (double seconds, juce::MidiMessage m)
+        {
+            m.setTimeStamp(seconds);
+            seq.addEvent(m);
+        };
+
+        add(0.0, juce::MidiMessage::noteOn(1, 62, (juce::uint8) 100));
+        for (int i = 0; i <= 20; ++i)
+            add(0.5 + 0.05 * i, juce::MidiMessage::controllerEvent(1, 1, 5 * i));
+
+        add(2.0, juce::MidiMessage::noteOn(1, 65, (juce::uint8) 90));
+        add(2.05, juce::MidiMessage::noteOff(1, 62));
+
+        for (int i = 0; i <= 16; ++i)
+        {
+            const double t = 2.5 + 0.05 * i;
+            const int bend = 8192 + (int) (1500.0 * std::sin(juce::MathConstants<double>::twoPi * 2.0 * (t - 2.5)));
+            add(t, juce::MidiMessage::pitchWheel(1, bend));
+            add(t, juce::MidiMessage::channelPressureChange(1, 8 * i));
+        }
+        add(3.35, juce::MidiMessage::pitchWheel(1, 8192));
+        add(3.35, juce::MidiMessage::channelPressureChange(1, 0));
+        add(3.5, juce::MidiMessage::noteOff(1, 65));
+
+        const int staccato[] = { 69, 67, 64 };
+        for (int i = 0; i < 3; ++i)
+        {
+            add(4.0 + 0.25 * i, juce::MidiMessage::noteOn(1, staccato[i], (juce::uint8) 110));
+            add(4.15 + 0.25 * i, juce::MidiMessage::noteOff(1, staccato[i]));
+        }
+
+        add(5.0, juce::MidiMessage::noteOn(1, 60, (juce::uint8) 80));
+        for (int i = 0; i <= 20; ++i)
+            add(5.0 + 0.05 * i, juce::MidiMessage::controllerEvent(1, 1, 100 - 5 * i));
+        add(6.5, juce::MidiMessage::noteOff(1, 60));
+
+        return seq;
+    }
+
+    bool loadMidiFile (const juce::File& file, juce::MidiMessageSequence& seq)
+    {
+        juce::FileInputStream in (file);
+        juce::MidiFile midi;
+
+        if (! in.openedOk() || ! midi.readFrom(in))
+            return false;
+
+        midi.convertTimestampTicksToSeconds();
+        for (int t = 0; t < midi.getNumTracks(); ++t)
+            seq.addSequence(*midi.getTrack(t), 0.0);
+
+        return seq.getNumEvents() > 0;
+    }
+
+    bool writeWav (const juce::File& file, const juce::AudioBuffer<float>& audio, double sampleRate)
+    {
+        file.getParentDirectory().createDirectory();
+        file.deleteFile();
+
+        auto stream = std::make_unique<juce::FileOutputStream>(file);
+        if (! stream->openedOk())
+            return false;
+
+        juce::WavAudioFormat wav;
+        std::unique_ptr<juce::AudioFormatWriter> writer (
+            wav.createWriterFor(stream.get(), sampleRate, (unsigned int) audio.getNumChannels(), 24, {}, 0));
+        if (writer == nullptr)
+            return false;
+
+        stream.release(); // owned by the writer now
+        return writer->writeFromAudioSampleBuffer(audio, 0, audio.getNumSamples());
+    }
+
+    RenderResult renderPreset (const juce::File& presetFile, const juce::File& wavFile,
+                               const juce::MidiMessageSequence& phrase, const RenderSettings& settings)
+    {
+        RenderResult result;
+        result.name = presetFile.getFileNameWithoutExtension();
+
+        BreathLeadPlugin plugin;
+        auto xml = juce::XmlDocument::parse(presetFile);
+        if (xml == nullptr || ! plugin.applyPreset(*xml))
+        {
+            result.error = "not a BreathLead preset";
+            return result;
+        }
+
+        const double sr = settings.sampleRate;
+        const int blockSize = settings.blockSize;
+        plugin.setRateAndBufferSizeDetails(sr, blockSize);
+        plugin.prepareToPlay(sr, blockSize);
+
+        const int numChannels = plugin.getTotalNumOutputChannels();
+        const int totalSamples = (int) std::ceil((phrase.getEndTime() + settings.tailSeconds) * sr);
+        juce::AudioBuffer<float> output (numChannels, totalSamples);
+        juce::AudioBuffer<float> block (numChannels, blockSize);
+        juce::MidiBuffer midi;
+        int nextEvent = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (int pos = 0; pos < totalSamples; pos += blockSize)
+        {
+            const int n = std::min(blockSize, totalSamples - pos);
+
+            midi.clear();
+            for (; nextEvent < phrase.getNumEvents(); ++nextEvent)
+            {
+                const auto& msg = phrase.getEventPointer(nextEvent)->message;
+                const int samplePos = juce::roundToInt(msg.getTimeStamp() * sr);
+                if (samplePos >= pos + n)
+                    break;
+                midi.addEvent(msg, std::max(0, samplePos - pos));
+            }
+
+            juce::AudioBuffer<float> view (block.getArrayOfWritePointers(), numChannels, n);
+            plugin.processBlock(view, midi);
+
+            for (int c = 0; c < numChannels; ++c)
+                output.copyFrom(c, pos, view, c, 0, n);
+        }
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        plugin.releaseResources();
+
+        result.audioSeconds = totalSamples / sr;
+        result.renderSeconds = elapsed.count();
+
+        for (int c = 0; c < numChannels; ++c)
+        {
+            const float* data = output.getReadPointer(c);
+            for (int i = 0; i < totalSamples; ++i)
+            {
+                if (! std::isfinite(data[i]))
+                {
+                    result.error = "non-finite output";
+                    return result;
+                }
+                result.peak = std::max(result.peak, std::abs(data[i]));
+            }
+        }
+
+        if (! writeWav(wavFile, output, sr))
+            result.error = "could not write " + wavFile.getFullPathName();
+
+        return result;
+    }
+
+    void printUsage()
+    {
+        std::printf("usage: BreathLeadPresetRender <presetDir> <outputDir> "
+                    "[--threads N] [--rate Hz] [--block N] [--midi file.mid]\n");
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    // APVTS and its parameter timers expect a message manager
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    RenderSettings settings;
+    int numThreads = juce::SystemStats::getNumCpus();
+    juce::File midiFile;
+    juce::StringArray positional;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const juce::String arg (argv[i]);
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--threads" && hasValue)     numThreads = juce::String(argv[++i]).getIntValue();
+        else if (arg == "--rate" && hasValue)   settings.sampleRate = juce::String(argv[++i]).getDoubleValue();
+        else if (arg == "--block" && hasValue)  settings.blockSize = juce::String(argv[++i]).getIntValue();
+        else if (arg == "--midi" && hasValue)   midiFile = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+        else if (arg.startsWith("--"))          { printUsage(); return 1; }
+        else                                    positional.add(arg);
+    }
+
+    if (positional.size() != 2 || numThreads < 1 || settings.sampleRate <= 0.0 || settings.blockSize < 1)
+    {
+        printUsage();
+        return 1;
+    }
+
+    const auto presetDir = juce::File::getCurrentWorkingDirectory().getChildFile(positional[0]);
+    const auto outputDir = juce::File::getCurrentWorkingDirectory().getChildFile(positional[1]);
+
+    juce::MidiMessageSequence phrase;
+    if (midiFile != juce::File())
+    {
+        if (! loadMidiFile(midiFile, phrase))
+        {
+            std::printf("could not read MIDI file %s\n", midiFile.getFullPathName().toRawUTF8());
+            return 1;
+        }
+    }
+    else
+    {
+        phrase = makeTestPhrase();
+    }
+
+    auto presetFiles = presetDir.findChildFiles(juce::File::findFiles, true, "*.xml");
+    presetFiles.sort();
+    if (presetFiles.isEmpty())
+    {
+        std::printf("no preset XMLs under %s\n", presetDir.getFullPathName().toRawUTF8());
+        return 1;
+    }
+
+    std::printf("rendering %d presets on %d threads at %.0f Hz, block %d\n",
+                presetFiles.size(), numThreads, settings.sampleRate, settings.blockSize);
+
+    // each job owns its plugin and writes only its own result slot
+    std::vector<RenderResult> results ((size_t) presetFiles.size());
+    const auto wallStart = std::chrono::steady_clock::now();
+
+    {
+        juce::ThreadPool pool (numThreads);
+
+        for (int i = 0; i < presetFiles.size(); ++i)
+        {
+            const auto presetFile = presetFiles[i];
+            const auto wavFile = outputDir.getChildFile(presetFile.getRelativePathFrom(presetDir))
+                                          .withFileExtension("wav");
+
+            pool.addJob([&results, &phrase, &settings, presetFile, wavFile, i]
+            {
+                results[(size_t) i] = renderPreset(presetFile, wavFile, phrase, settings);
+            });
+        }
+
+        while (pool.getNumJobs() > 0)
+            juce::Thread::sleep(10);
+    }
+
+    const std::chrono::duration<double> wall = std::chrono::steady_clock::now() - wallStart;
+
+    int numFailed = 0;
+    double totalAudio = 0.0;
+
+    for (const auto& r : results)
+    {
+        if (r.error.isNotEmpty())
+        {
+            ++numFailed;
+            std::printf("  %-28s FAILED: %s\n", r.name.toRawUTF8(), r.error.toRawUTF8());
+            continue;
+        }
+
+        totalAudio += r.audioSeconds;
+        std::printf("  %-28s %8.1fx realtime   peak %6.1f dBFS\n", r.name.toRawUTF8(),
+                    r.audioSeconds / r.renderSeconds, juce::Decibels::gainToDecibels(r.peak, -120.0f));
+    }
+
+    std::printf("%d rendered, %d failed: %.1f s of audio in %.2f s wall clock (%.1fx realtime overall)\n",
+                (int) results.size() - numFailed, numFailed, totalAudio, wall.count(), totalAudio / wall.count());
+
+    return (numFailed == 0) ? 0 : 1;
+}